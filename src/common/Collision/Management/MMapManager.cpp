@@ -19,18 +19,130 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MMapDefines.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>
 
 namespace MMAP
 {
     constexpr char MAP_FILE_NAME_FORMAT[] = "{}mmaps/{:04}.mmap";
     constexpr char TILE_FILE_NAME_FORMAT[] = "{}mmaps/{:04}{:02}{:02}.mmtile";
 
+    namespace
+    {
+        std::atomic<uint64> PathCacheHits;
+        std::atomic<uint64> PathCacheMisses;
+
+        // drops cached corridors that adding or removing the tile changes, must be called with tileLock held exclusively
+        void InvalidatePathCache(MMapData* mmap, dtTileRef tileRef, bool added)
+        {
+            std::vector<dtTileRef> tiles = { tileRef };
+            if (added)
+            {
+                // new tile links its polygons to neighbours, corridors through them may be shorter now
+                dtMeshTile const* tile = mmap->navMesh->getTileByRef(tileRef);
+                for (int32 dx = -1; dx <= 1; ++dx)
+                {
+                    for (int32 dy = -1; dy <= 1; ++dy)
+                    {
+                        std::array<dtMeshTile const*, 4> neighbours;
+                        int32 count = mmap->navMesh->getTilesAt(tile->header->x + dx, tile->header->y + dy, neighbours.data(), int32(neighbours.size()));
+                        for (int32 i = 0; i < count; ++i)
+                            if (neighbours[i] != tile)
+                                tiles.push_back(mmap->navMesh->getTileRef(neighbours[i]));
+                    }
+                }
+            }
+
+            mmap->pathCache.Clear(*mmap->navMesh, tiles, added);
+        }
+    }
+
+    // ######################## PathCache ########################
+    bool PathCache::Find(PathCacheKey const& key, dtPolyRef* path, int32* pathSize, int32 maxPathSize, dtStatus* status)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto itr = _index.find(key);
+        if (itr == _index.end() || int32(itr->second->Path.size()) > maxPathSize)
+        {
+            PathCacheMisses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        _entries.splice(_entries.begin(), _entries, itr->second);
+
+        Entry const& entry = *itr->second;
+        std::copy(entry.Path.begin(), entry.Path.end(), path);
+        *pathSize = int32(entry.Path.size());
+        *status = entry.Status;
+        PathCacheHits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void PathCache::Insert(PathCacheKey const& key, dtPolyRef const* path, int32 pathSize, dtStatus status)
+    {
+        if (!_capacity)
+            return;
+
+        std::lock_guard<std::mutex> lock(_lock);
+        auto [itr, inserted] = _index.try_emplace(key);
+        if (inserted)
+        {
+            // reuse storage of the least recently used entry once full
+            if (_index.size() > _capacity)
+            {
+                _index.erase(_entries.back().Key);
+                _entries.splice(_entries.begin(), _entries, std::prev(_entries.end()));
+            }
+            else
+                _entries.emplace_front();
+
+            itr->second = _entries.begin();
+        }
+        else
+            _entries.splice(_entries.begin(), _entries, itr->second);
+
+        Entry& entry = *itr->second;
+        entry.Key = key;
+        entry.Status = status;
+        entry.Path.assign(path, path + pathSize);
+    }
+
+    void PathCache::Clear(dtNavMesh const& navMesh, std::span<dtTileRef const> tiles, bool partialResults)
+    {
+        auto isInTiles = [&](dtPolyRef poly)
+        {
+            uint32 tileIndex = navMesh.decodePolyIdTile(poly);
+            return std::ranges::any_of(tiles, [&](dtTileRef tile) { return navMesh.decodePolyIdTile(tile) == tileIndex; });
+        };
+
+        std::lock_guard<std::mutex> lock(_lock);
+        for (auto itr = _entries.begin(); itr != _entries.end();)
+        {
+            if ((partialResults && dtStatusDetail(itr->Status, DT_PARTIAL_RESULT))
+                || isInTiles(itr->Key.StartPoly) || isInTiles(itr->Key.EndPoly) || std::ranges::any_of(itr->Path, isInTiles))
+            {
+                _index.erase(itr->Key);
+                itr = _entries.erase(itr);
+            }
+            else
+                ++itr;
+        }
+    }
+
+    PathCacheStatistics PathCache::ConsumeStatistics()
+    {
+        PathCacheStatistics statistics;
+        statistics.Hits = PathCacheHits.exchange(0, std::memory_order_relaxed);
+        statistics.Misses = PathCacheMisses.exchange(0, std::memory_order_relaxed);
+        return statistics;
+    }
+
     // ######################## MMapManager ########################
     MMapManager::~MMapManager()
     {
-        for (std::pair<uint32 const, MMapData*>& loadedMMap : loadedMMaps)
-            delete loadedMMap.second;
-
         // by now we should not have maps loaded
         // if we had, tiles in MMapData->mmapLoadedTiles, their actual data is lost!
     }
@@ -105,9 +217,7 @@ namespace MMAP
         TC_LOG_DEBUG("maps", "MMAP:loadMapData: Loaded {:04}.mmap", mapId);
 
         // store inside our map list
-        MMapData* mmap_data = new MMapData(mesh);
-
-        itr->second = mmap_data;
+        itr->second = std::make_shared<MMapData>(mesh, pathCacheSize);
         return true;
     }
 
@@ -123,7 +233,7 @@ namespace MMAP
             return false;
 
         // get this mmap data
-        MMapData* mmap = loadedMMaps[mapId];
+        MMapData* mmap = loadedMMaps[mapId].get();
         ASSERT(mmap->navMesh);
 
         // check if we already have this tile loaded
@@ -133,6 +243,28 @@ namespace MMAP
 
         // load this tile :: mmaps/MMMMXXYY.mmtile
         std::string fileName = Trinity::StringFormat(TILE_FILE_NAME_FORMAT, basePath, mapId, x, y);
+        if (useMemoryMappedFiles)
+        {
+            std::unique_ptr<Trinity::MappedFile> mappedFile = Trinity::MappedFile::Open(fileName.c_str(), Trinity::MappedFile::Access::CopyOnWrite);
+            if (!mappedFile)
+            {
+                auto parentMapItr = parentMapData.find(mapId);
+                if (parentMapItr != parentMapData.end())
+                {
+                    fileName = Trinity::StringFormat(TILE_FILE_NAME_FORMAT, basePath, parentMapItr->second, x, y);
+                    mappedFile = Trinity::MappedFile::Open(fileName.c_str(), Trinity::MappedFile::Access::CopyOnWrite);
+                }
+            }
+
+            if (!mappedFile)
+            {
+                TC_LOG_DEBUG("maps", "MMAP:loadMap: Could not open mmtile file '{}'", fileName);
+                return false;
+            }
+
+            return loadMappedTile(mmap, mapId, x, y, std::move(mappedFile));
+        }
+
         FILE* file = fopen(fileName.c_str(), "rb");
         if (!file)
         {
@@ -194,9 +326,12 @@ namespace MMAP
         dtMeshHeader* header = (dtMeshHeader*)data;
         dtTileRef tileRef = 0;
 
+        std::unique_lock<std::shared_mutex> lock(mmap->tileLock);
+
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
         if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
+            InvalidatePathCache(mmap, tileRef, true);
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
             ++loadedTiles;
             TC_LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:04}[{:02}, {:02}] into {:04}[{:02}, {:02}]", mapId, x, y, mapId, header->x, header->y);
@@ -210,12 +345,77 @@ namespace MMAP
         }
     }
 
+    void MMapManager::prefetchMap(std::string const& basePath, uint32 mapId, int32 x, int32 y)
+    {
+        if (Trinity::MappedFile::Prefetch(Trinity::StringFormat(TILE_FILE_NAME_FORMAT, basePath, mapId, x, y).c_str()))
+            return;
+
+        auto parentMapItr = parentMapData.find(mapId);
+        if (parentMapItr != parentMapData.end())
+            Trinity::MappedFile::Prefetch(Trinity::StringFormat(TILE_FILE_NAME_FORMAT, basePath, parentMapItr->second, x, y).c_str());
+    }
+
+    bool MMapManager::loadMappedTile(MMapData* mmap, uint32 mapId, int32 x, int32 y, std::unique_ptr<Trinity::MappedFile> file)
+    {
+        std::span<uint8 const> fileData = file->GetData();
+
+        // read header
+        MmapTileHeader fileHeader;
+        if (fileData.size() < sizeof(MmapTileHeader))
+        {
+            TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:04}{:02}{:02}.mmtile", mapId, x, y);
+            return false;
+        }
+
+        memcpy(&fileHeader, fileData.data(), sizeof(MmapTileHeader));
+        if (fileHeader.mmapMagic != MMAP_MAGIC)
+        {
+            TC_LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:04}{:02}{:02}.mmtile", mapId, x, y);
+            return false;
+        }
+
+        if (fileHeader.mmapVersion != MMAP_VERSION)
+        {
+            TC_LOG_ERROR("maps", "MMAP:loadMap: {:04}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
+                mapId, x, y, fileHeader.mmapVersion, MMAP_VERSION);
+            return false;
+        }
+
+        if (fileHeader.size > fileData.size() - sizeof(MmapTileHeader))
+        {
+            TC_LOG_ERROR("maps", "MMAP:loadMap: {:04}{:02}{:02}.mmtile has corrupted data size", mapId, x, y);
+            return false;
+        }
+
+        // tile data is used in place, detour writes link lists, poly->firstLink and off-mesh connection
+        // vertices into it, so those pages become private copies
+        // pages holding detail meshes and BV tree stay shared with every process mapping the file
+        unsigned char* data = file->GetWritableData() + sizeof(MmapTileHeader);
+        dtMeshHeader* header = (dtMeshHeader*)data;
+        dtTileRef tileRef = 0;
+
+        std::unique_lock<std::shared_mutex> lock(mmap->tileLock);
+        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, 0, 0, &tileRef)))
+        {
+            InvalidatePathCache(mmap, tileRef, true);
+            uint32 packedGridPos = packTileID(x, y);
+            mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+            mmap->mappedTiles[packedGridPos] = std::move(file);
+            ++loadedTiles;
+            TC_LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:04}[{:02}, {:02}] into {:04}[{:02}, {:02}]", mapId, x, y, mapId, header->x, header->y);
+            return true;
+        }
+
+        TC_LOG_ERROR("maps", "MMAP:loadMap: Could not load {:04}{:02}{:02}.mmtile into navmesh", mapId, x, y);
+        return false;
+    }
+
     bool MMapManager::loadMapInstance(std::string const& basePath, uint32 meshMapId, uint32 instanceMapId, uint32 instanceId)
     {
         if (!loadMapData(basePath, meshMapId))
             return false;
 
-        MMapData* mmap = loadedMMaps[meshMapId];
+        MMapData* mmap = loadedMMaps[meshMapId].get();
         auto [queryItr, inserted] = mmap->navMeshQueries.try_emplace({ instanceMapId, instanceId }, nullptr);
         if (!inserted)
             return true;
@@ -247,7 +447,7 @@ namespace MMAP
             return false;
         }
 
-        MMapData* mmap = itr->second;
+        MMapData* mmap = itr->second.get();
 
         // check if we have this tile loaded
         uint32 packedGridPos = packTileID(x, y);
@@ -259,6 +459,8 @@ namespace MMAP
             return false;
         }
 
+        std::unique_lock<std::shared_mutex> lock(mmap->tileLock);
+
         // unload, and mark as non loaded
         if (dtStatusFailed(mmap->navMesh->removeTile(tileRefItr->second, nullptr, nullptr)))
         {
@@ -270,7 +472,9 @@ namespace MMAP
         }
         else
         {
+            InvalidatePathCache(mmap, tileRefItr->second, false);
             mmap->loadedTileRefs.erase(tileRefItr);
+            mmap->mappedTiles.erase(packedGridPos);
             --loadedTiles;
             TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:04}[{:02}, {:02}] from {:03}", mapId, x, y, mapId);
             return true;
@@ -290,7 +494,8 @@ namespace MMAP
         }
 
         // unload all tiles from given map
-        MMapData* mmap = itr->second;
+        MMapData* mmap = itr->second.get();
+        std::unique_lock<std::shared_mutex> lock(mmap->tileLock);
         for (MMapTileSet::iterator i = mmap->loadedTileRefs.begin(); i != mmap->loadedTileRefs.end(); ++i)
         {
             uint32 x = (i->first >> 16);
@@ -304,7 +509,9 @@ namespace MMAP
             }
         }
 
-        delete mmap;
+        lock.unlock();
+
+        // navmesh is freed once pathfinding threads release their references to it
         itr->second = nullptr;
         TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded {:04}.mmap", mapId);
 
@@ -322,7 +529,7 @@ namespace MMAP
             return false;
         }
 
-        MMapData* mmap = itr->second;
+        MMapData* mmap = itr->second.get();
         auto queryItr = mmap->navMeshQueries.find({ instanceMapId, instanceId });
         if (queryItr == mmap->navMeshQueries.end())
         {
@@ -346,6 +553,27 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
+    PathCache* MMapManager::GetPathCache(uint32 mapId)
+    {
+        if (!pathCacheSize)
+            return nullptr;
+
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+            return nullptr;
+
+        return &itr->second->pathCache;
+    }
+
+    std::shared_ptr<MMapData> MMapManager::GetNavMeshData(uint32 mapId)
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+            return nullptr;
+
+        return itr->second;
+    }
+
     dtNavMeshQuery const* MMapManager::GetNavMeshQuery(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId)
     {
         auto itr = GetMMapData(meshMapId);
@@ -22,6 +22,12 @@
 #include "DetourNavMesh.h"
 #include "DetourNavMeshQuery.h"
 #include "Hash.h"
+#include "MappedFile.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -32,10 +38,78 @@ namespace MMAP
     typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
     typedef std::unordered_map<std::pair<uint32, uint32>, dtNavMeshQuery*> NavMeshQuerySet;
 
+    struct PathCacheKey
+    {
+        uint32 InstanceMapId;
+        uint32 InstanceId;
+        dtPolyRef StartPoly;
+        dtPolyRef EndPoly;
+        uint16 IncludeFlags;
+        uint16 ExcludeFlags;
+
+        bool operator==(PathCacheKey const& right) const = default;
+    };
+
+    struct PathCacheKeyHash
+    {
+        std::size_t operator()(PathCacheKey const& key) const
+        {
+            std::size_t hashVal = 0;
+            Trinity::hash_combine(hashVal, key.StartPoly);
+            Trinity::hash_combine(hashVal, key.EndPoly);
+            Trinity::hash_combine(hashVal, key.InstanceMapId);
+            Trinity::hash_combine(hashVal, key.InstanceId);
+            Trinity::hash_combine(hashVal, uint32(key.IncludeFlags) << 16 | key.ExcludeFlags);
+            return hashVal;
+        }
+    };
+
+    struct PathCacheStatistics
+    {
+        uint64 Hits = 0;
+        uint64 Misses = 0;
+    };
+
+    // least recently used polygon corridors found by dtNavMeshQuery::findPath on one navmesh
+    // shared by all instances using the mesh, safe to use from any thread
+    class TC_COMMON_API PathCache
+    {
+        public:
+            explicit PathCache(std::size_t capacity) : _capacity(capacity) { }
+
+            PathCache(PathCache const&) = delete;
+            PathCache& operator=(PathCache const&) = delete;
+
+            // copies the cached corridor into path if it fits in maxPathSize polygons
+            bool Find(PathCacheKey const& key, dtPolyRef* path, int32* pathSize, int32 maxPathSize, dtStatus* status);
+            void Insert(PathCacheKey const& key, dtPolyRef const* path, int32 pathSize, dtStatus status);
+
+            // drops corridors passing through any of the tiles, and with partialResults also those that did not reach their destination
+            // polygon references of a tile are invalid once it is removed, an added tile can complete or shorten corridors through its neighbours
+            void Clear(dtNavMesh const& navMesh, std::span<dtTileRef const> tiles, bool partialResults);
+
+            static PathCacheStatistics ConsumeStatistics();
+
+        private:
+            struct Entry
+            {
+                PathCacheKey Key;
+                dtStatus Status;
+                std::vector<dtPolyRef> Path;
+            };
+
+            typedef std::list<Entry> EntryList;
+
+            std::size_t _capacity;
+            std::mutex _lock;
+            EntryList _entries;     // most recently used first
+            std::unordered_map<PathCacheKey, EntryList::iterator, PathCacheKeyHash> _index;
+    };
+
     // dummy struct to hold map's mmap data
     struct TC_COMMON_API MMapData
     {
-        MMapData(dtNavMesh* mesh) : navMesh(mesh) { }
+        MMapData(dtNavMesh* mesh, std::size_t pathCacheSize) : navMesh(mesh), pathCache(pathCacheSize) { }
         ~MMapData()
         {
             for (NavMeshQuerySet::iterator i = navMeshQueries.begin(); i != navMeshQueries.end(); ++i)
@@ -50,16 +124,25 @@ namespace MMAP
 
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs;        // maps [map grid coords] to [dtTile]
+
+        // [map grid coords] to file backing tile data, navMesh does not own memory mapped tiles
+        std::unordered_map<uint32, std::unique_ptr<Trinity::MappedFile>> mappedTiles;
+
+        // held exclusively while adding or removing tiles
+        std::shared_mutex tileLock;
+
+        PathCache pathCache;
     };
 
-    typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
+    // shared with pathfinding threads, which may still query a navmesh after its map is unloaded
+    typedef std::unordered_map<uint32, std::shared_ptr<MMapData>> MMapDataSet;
 
     // singleton class
     // holds all all access to mmap loading unloading and meshes
     class TC_COMMON_API MMapManager
     {
         public:
-            MMapManager() : loadedTiles(0), thread_safe_environment(true) {}
+            MMapManager() : loadedTiles(0), thread_safe_environment(true), useMemoryMappedFiles(false), pathCacheSize(0) {}
             ~MMapManager();
 
             void InitializeThreadUnsafe(std::unordered_map<uint32, std::vector<uint32>> const& mapData);
@@ -69,20 +152,39 @@ namespace MMAP
             bool unloadMap(uint32 mapId);
             bool unloadMapInstance(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId);
 
+            // reads the tile file into the OS page cache, safe to call from any thread
+            void prefetchMap(std::string const& basePath, uint32 mapId, int32 x, int32 y);
+
             // the returned [dtNavMeshQuery const*] is NOT threadsafe
             dtNavMeshQuery const* GetNavMeshQuery(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId);
             dtNavMesh const* GetNavMesh(uint32 mapId);
 
+            // keeps the navmesh, its path cache and tile lock alive for threads that query it outside of map updates
+            // tileLock must be held shared while querying from threads that do not load its tiles
+            std::shared_ptr<MMapData> GetNavMeshData(uint32 mapId);
+
+            // tiles reference data in memory mapped files, shared with other processes using the same files
+            void SetUseMemoryMappedFiles(bool enable) { useMemoryMappedFiles = enable; }
+
+            // number of polygon corridors remembered per navmesh, 0 disables the cache
+            void SetPathCacheSize(uint32 size) { pathCacheSize = size; }
+
+            // returns nullptr if the cache is disabled
+            PathCache* GetPathCache(uint32 mapId);
+
             uint32 getLoadedTilesCount() const { return loadedTiles; }
             uint32 getLoadedMapsCount() const { return uint32(loadedMMaps.size()); }
         private:
             bool loadMapData(std::string const& basePath, uint32 mapId);
+            bool loadMappedTile(MMapData* mmap, uint32 mapId, int32 x, int32 y, std::unique_ptr<Trinity::MappedFile> file);
             uint32 packTileID(int32 x, int32 y);
 
             MMapDataSet::const_iterator GetMMapData(uint32 mapId) const;
             MMapDataSet loadedMMaps;
             uint32 loadedTiles;
             bool thread_safe_environment;
+            bool useMemoryMappedFiles;
+            uint32 pathCacheSize;
 
             std::unordered_map<uint32, uint32> parentMapData;
     };
@@ -305,6 +305,14 @@ namespace VMAP
         return StaticMapTree::CanLoadMap(std::string(basePath), mapId, x, y, this);
     }
 
+    void VMapManager2::prefetchMap(char const* basePath, unsigned int mapId, int x, int y)
+    {
+        if (!isMapLoadingEnabled())
+            return;
+
+        StaticMapTree::PrefetchMapTile(std::string(basePath), mapId, x, y, this);
+    }
+
     void VMapManager2::getInstanceMapTree(InstanceTreeMap &instanceMapTree)
     {
         instanceMapTree = iInstanceMapTrees;
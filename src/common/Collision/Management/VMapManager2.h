@@ -112,6 +112,9 @@ namespace VMAP
             }
             virtual LoadResult existsMap(char const* basePath, unsigned int mapId, int x, int y) override;
 
+            // reads tile files into the OS page cache, safe to call from any thread
+            void prefetchMap(char const* basePath, unsigned int mapId, int x, int y);
+
             void getInstanceMapTree(InstanceTreeMap &instanceMapTree);
 
             int32 getParentMapId(uint32 mapId) const;
@@ -18,6 +18,7 @@
 #include "MapTree.h"
 #include "Errors.h"
 #include "Log.h"
+#include "MappedFile.h"
 #include "Memory.h"
 #include "Metric.h"
 #include "ModelInstance.h"
@@ -257,6 +258,19 @@ namespace VMAP
         return LoadResult::Success;
     }
 
+    void StaticMapTree::PrefetchMapTile(std::string const& vmapPath, uint32 mapID, uint32 tileX, uint32 tileY, VMapManager2* vm)
+    {
+        std::string basePath = vmapPath;
+        if (basePath.length() > 0 && basePath[basePath.length() - 1] != '/' && basePath[basePath.length() - 1] != '\\')
+            basePath.push_back('/');
+
+        // same lookup as OpenMapTileFile, spawn indices are never taken from parent maps
+        Trinity::MappedFile::Prefetch((basePath + getTileFileName(mapID, tileX, tileY, "vmtileidx")).c_str());
+        for (int32 tileMapId = int32(mapID); tileMapId != -1; tileMapId = vm->getParentMapId(uint32(tileMapId)))
+            if (Trinity::MappedFile::Prefetch((basePath + getTileFileName(tileMapId, tileX, tileY, "vmtile")).c_str()))
+                break;
+    }
+
     //=========================================================
 
     LoadResult StaticMapTree::InitMap(std::string const& fname)
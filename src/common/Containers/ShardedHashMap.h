@@ -0,0 +1,146 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_SHARDED_HASH_MAP_H
+#define TRINITYCORE_SHARDED_HASH_MAP_H
+
+#include "EpochReclamation.h"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace Trinity::Containers
+{
+/*
+ * Read mostly hash map with lock free lookups.
+ * Elements are split into shards selected by key hash, every shard is an immutable map replaced
+ * as a whole on each modification (copy on write). Readers never lock or write shared memory,
+ * writers only serialize with writers of the same shard and copy shard contents,
+ * which makes modifications cost O(size / ShardCount).
+ */
+template <class Key, class Value, std::size_t ShardCount = 64, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class ShardedHashMap
+{
+public:
+    static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0, "ShardCount must be a power of 2");
+
+    ShardedHashMap() = default;
+
+    ~ShardedHashMap()
+    {
+        for (Shard& shard : _shards)
+            delete shard.Storage.load(std::memory_order_relaxed);
+    }
+
+    ShardedHashMap(ShardedHashMap const&) = delete;
+    ShardedHashMap& operator=(ShardedHashMap const&) = delete;
+
+    void Insert(Key const& key, Value value)
+    {
+        Shard& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.WriteLock);
+        StorageType const* current = shard.Storage.load(std::memory_order_relaxed);
+        StorageType* replacement = current ? new StorageType(*current) : new StorageType();
+        replacement->insert_or_assign(key, std::move(value));
+        Publish(shard, current, replacement);
+    }
+
+    bool Remove(Key const& key)
+    {
+        Shard& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.WriteLock);
+        StorageType const* current = shard.Storage.load(std::memory_order_relaxed);
+        if (!current || current->find(key) == current->end())
+            return false;
+
+        StorageType* replacement = new StorageType(*current);
+        replacement->erase(key);
+        Publish(shard, current, replacement);
+        return true;
+    }
+
+    // Returns a copy of the stored value or a value initialized Value if key is not present
+    Value Find(Key const& key) const
+    {
+        EpochReclamation::ReadGuard guard;
+        if (StorageType const* storage = GetShard(key).Storage.load(std::memory_order_acquire))
+        {
+            auto itr = storage->find(key);
+            if (itr != storage->end())
+                return itr->second;
+        }
+
+        return Value();
+    }
+
+    // Calls worker(key, value) for every element, each shard is visited as it was when the worker reached it
+    // worker may modify the map, changes to shards not visited yet are seen by later calls
+    template <typename Worker>
+    void DoForAll(Worker&& worker) const
+    {
+        EpochReclamation::ReadGuard guard;
+        for (Shard const& shard : _shards)
+            if (StorageType const* storage = shard.Storage.load(std::memory_order_acquire))
+                for (auto const& [key, value] : *storage)
+                    worker(key, value);
+    }
+
+    std::size_t Size() const
+    {
+        EpochReclamation::ReadGuard guard;
+        std::size_t size = 0;
+        for (Shard const& shard : _shards)
+            if (StorageType const* storage = shard.Storage.load(std::memory_order_acquire))
+                size += storage->size();
+
+        return size;
+    }
+
+private:
+    typedef std::unordered_map<Key, Value, Hash, KeyEqual> StorageType;
+
+    // every shard on its own cache line
+    struct alignas(64) Shard
+    {
+        std::atomic<StorageType const*> Storage = nullptr;
+        std::mutex WriteLock;
+    };
+
+    static void Publish(Shard& shard, StorageType const* current, StorageType const* replacement)
+    {
+        shard.Storage.store(replacement, std::memory_order_release);
+        if (current)
+            EpochReclamation::Retire(current);
+    }
+
+    Shard& GetShard(Key const& key) { return _shards[SelectShard(key)]; }
+    Shard const& GetShard(Key const& key) const { return _shards[SelectShard(key)]; }
+
+    static std::size_t SelectShard(Key const& key)
+    {
+        // fold upper bits in, hashes that only differ there still spread across shards
+        std::size_t hash = Hash()(key);
+        return (hash ^ (hash >> 16) ^ (hash >> 31)) & (ShardCount - 1);
+    }
+
+    std::array<Shard, ShardCount> _shards;
+};
+}
+
+#endif // TRINITYCORE_SHARDED_HASH_MAP_H
@@ -22,6 +22,7 @@
 #include "Errors.h"
 #include "LogMessage.h"
 #include "LogOperation.h"
+#include "LogRingBuffer.h"
 #include "Logger.h"
 #include "Strand.h"
 #include "StringConvert.h"
@@ -35,6 +36,7 @@ Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), m_logsTimestamp('_'
 
 Log::~Log()
 {
+    _ringBufferWriter = nullptr;
     delete _strand;
     Close();
 }
@@ -219,7 +221,17 @@ void Log::RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn)
 
 void Log::OutMessageImpl(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) const noexcept
 {
-    if (_ioContext)
+    if (_ringBufferWriter)
+    {
+        if (_ringBufferWriter->Write(logger, filter, level, messageFormat, messageFormatArgs))
+            return;
+
+        // buffer is full, write everything queued before this message first to keep the order
+        _ringBufferWriter->Flush();
+        LogMessage msg(level, filter, Trinity::StringVFormat(messageFormat, messageFormatArgs));
+        logger->write(&msg);
+    }
+    else if (_ioContext)
         Trinity::Asio::post(*_strand, LogOperation(logger, new LogMessage(level, filter, Trinity::StringVFormat(messageFormat, messageFormatArgs))));
     else
     {
@@ -323,6 +335,9 @@ void Log::SetRealmId(uint32 id)
 
 void Log::Close()
 {
+    if (_ringBufferWriter)
+        _ringBufferWriter->Flush();
+
     loggers.clear();
     appenders.clear();
 }
@@ -373,11 +388,15 @@ void Log::Initialize(Trinity::Asio::IoContext* ioContext)
         _strand = new Trinity::Asio::Strand(*ioContext);
     }
 
+    if (int32 ringBufferSize = sConfigMgr->GetIntDefault("Log.RingBuffer.Size", 0); ringBufferSize > 0)
+        _ringBufferWriter = std::make_unique<LogRingBufferWriter>(ringBufferSize);
+
     LoadFromConfig();
 }
 
 void Log::SetSynchronous()
 {
+    _ringBufferWriter = nullptr;
     delete _strand;
     _strand = nullptr;
     _ioContext = nullptr;
@@ -28,6 +28,7 @@
 
 class Appender;
 class Logger;
+class LogRingBufferWriter;
 struct LogMessage;
 
 namespace Trinity
@@ -150,6 +151,7 @@ class TC_COMMON_API Log
 
         Trinity::Asio::IoContext* _ioContext;
         Trinity::Asio::Strand* _strand;
+        std::unique_ptr<LogRingBufferWriter> _ringBufferWriter;
 };
 
 #define sLog Log::instance()
@@ -0,0 +1,184 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogRingBuffer.h"
+#include "LogMessage.h"
+#include "Logger.h"
+#include <algorithm>
+
+LogRingBuffer::LogRingBuffer(std::size_t capacity) : _entries(std::make_unique<Entry[]>(capacity)), _capacity(capacity),
+    _head(0), _tail(0), _abandoned(false)
+{
+}
+
+LogRingBuffer::~LogRingBuffer() = default;
+
+bool LogRingBuffer::Write(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) noexcept
+{
+    std::size_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) >= _capacity)
+        return false;
+
+    if (filter.length() > Entry::MaxFilterLength)
+        return false;
+
+    Entry& entry = _entries[head % _capacity];
+    try
+    {
+        fmt::format_to_n_result<char*> result = fmt::vformat_to_n(entry.Text.data(), entry.Text.size(), messageFormat, messageFormatArgs);
+        if (result.size > entry.Text.size())
+            entry.LongText = std::make_unique<std::string>(Trinity::StringVFormat(messageFormat, messageFormatArgs));
+        else
+            entry.TextLength = uint16(result.size);
+    }
+    catch (std::exception const&)
+    {
+        // let the regular path format the error message
+        return false;
+    }
+
+    entry.Target = logger;
+    entry.Level = level;
+    entry.Time = time(nullptr);
+    entry.FilterLength = uint8(filter.length());
+    std::ranges::copy(filter, entry.Filter.begin());
+
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+namespace
+{
+std::atomic<uint32> NextWriterId = 0;
+
+// buffer of calling thread, abandoned when the thread exits
+struct ThreadLogRingBuffer
+{
+    uint32 WriterId = 0;
+    std::shared_ptr<LogRingBuffer> Buffer;
+
+    ~ThreadLogRingBuffer()
+    {
+        if (Buffer)
+            Buffer->Abandon();
+    }
+};
+
+thread_local ThreadLogRingBuffer CurrentThreadBuffer;
+}
+
+LogRingBufferWriter::LogRingBufferWriter(std::size_t capacityPerThread) : _capacityPerThread(capacityPerThread),
+    _id(++NextWriterId), _wakeUp(0), _stopping(false)
+{
+    _thread = std::thread(&LogRingBufferWriter::WriterThread, this);
+}
+
+LogRingBufferWriter::~LogRingBufferWriter()
+{
+    _stopping = true;
+    _wakeUp = 1;
+    _wakeUp.notify_one();
+    _thread.join();
+
+    DrainAll();
+}
+
+bool LogRingBufferWriter::Write(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) noexcept
+{
+    LogRingBuffer* buffer = GetThreadBuffer();
+    if (!buffer || !buffer->Write(logger, filter, level, messageFormat, messageFormatArgs))
+        return false;
+
+    // pairs with the fence in WriterThread, either the writer sees the new entry or this thread sees it went back to sleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_wakeUp.load(std::memory_order_relaxed) == 0 && _wakeUp.exchange(1) == 0)
+        _wakeUp.notify_one();
+
+    return true;
+}
+
+void LogRingBufferWriter::Flush()
+{
+    DrainAll();
+}
+
+LogRingBuffer* LogRingBufferWriter::GetThreadBuffer()
+{
+    if (CurrentThreadBuffer.WriterId != _id)
+    {
+        if (CurrentThreadBuffer.Buffer)
+            CurrentThreadBuffer.Buffer->Abandon();
+
+        try
+        {
+            std::shared_ptr<LogRingBuffer> buffer = std::make_shared<LogRingBuffer>(_capacityPerThread);
+            {
+                std::lock_guard<std::mutex> lock(_buffersLock);
+                _buffers.push_back(buffer);
+            }
+
+            CurrentThreadBuffer.WriterId = _id;
+            CurrentThreadBuffer.Buffer = std::move(buffer);
+        }
+        catch (std::bad_alloc const&)
+        {
+            CurrentThreadBuffer.WriterId = 0;
+            CurrentThreadBuffer.Buffer = nullptr;
+            return nullptr;
+        }
+    }
+
+    return CurrentThreadBuffer.Buffer.get();
+}
+
+void LogRingBufferWriter::WriterThread()
+{
+    while (!_stopping)
+    {
+        _wakeUp.wait(0);
+        _wakeUp = 0;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        DrainAll();
+    }
+}
+
+std::size_t LogRingBufferWriter::DrainAll()
+{
+    std::lock_guard<std::mutex> drainLock(_drainLock);
+
+    std::vector<std::shared_ptr<LogRingBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(_buffersLock);
+        // buffers of exited threads can be dropped once everything they queued is written
+        std::erase_if(_buffers, [](std::shared_ptr<LogRingBuffer> const& buffer) { return buffer->IsAbandoned() && buffer->IsEmpty(); });
+        buffers = _buffers;
+    }
+
+    std::size_t written = 0;
+    for (std::shared_ptr<LogRingBuffer> const& buffer : buffers)
+    {
+        written += buffer->Drain([](LogRingBuffer::Entry const& entry)
+        {
+            LogMessage message(entry.Level, entry.GetFilter(), std::string(entry.GetText()));
+            message.mtime = entry.Time;
+            entry.Target->write(&message);
+        });
+    }
+
+    return written;
+}
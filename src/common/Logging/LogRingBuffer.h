@@ -0,0 +1,137 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LOG_RING_BUFFER_H
+#define TRINITYCORE_LOG_RING_BUFFER_H
+
+#include "Define.h"
+#include "LogCommon.h"
+#include "StringFormat.h"
+#include <array>
+#include <atomic>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+class Logger;
+
+/*
+ * Fixed size queue of formatted log messages written by a single thread and read by a single thread.
+ * Messages are formatted directly into preallocated entries, queueing one does not allocate or lock.
+ */
+class TC_COMMON_API LogRingBuffer
+{
+public:
+    struct Entry
+    {
+        static constexpr std::size_t MaxFilterLength = 48;
+        static constexpr std::size_t MaxTextLength = 440;
+
+        Logger const* Target;
+        LogLevel Level;
+        time_t Time;
+        uint8 FilterLength;
+        uint16 TextLength;
+        std::array<char, MaxFilterLength> Filter;
+        std::array<char, MaxTextLength> Text;
+        std::unique_ptr<std::string> LongText;  // only allocated for messages not fitting Text
+
+        std::string_view GetFilter() const { return { Filter.data(), FilterLength }; }
+        std::string_view GetText() const { return LongText ? std::string_view(*LongText) : std::string_view(Text.data(), TextLength); }
+    };
+
+    explicit LogRingBuffer(std::size_t capacity);
+    ~LogRingBuffer();
+
+    LogRingBuffer(LogRingBuffer const&) = delete;
+    LogRingBuffer& operator=(LogRingBuffer const&) = delete;
+
+    // Producer side, returns false without queueing anything when the buffer is full or filter does not fit an entry
+    bool Write(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) noexcept;
+
+    // Consumer side, calls handler for every queued entry in the order they were written and returns their number
+    template <typename Handler>
+    std::size_t Drain(Handler&& handler)
+    {
+        std::size_t tail = _tail.load(std::memory_order_relaxed);
+        std::size_t head = _head.load(std::memory_order_acquire);
+        for (std::size_t i = tail; i != head; ++i)
+        {
+            Entry& entry = _entries[i % _capacity];
+            handler(static_cast<Entry const&>(entry));
+            entry.LongText.reset();
+        }
+
+        _tail.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    bool IsEmpty() const { return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire); }
+
+    // set when the producing thread exits, the buffer can be destroyed once drained
+    void Abandon() { _abandoned.store(true, std::memory_order_release); }
+    bool IsAbandoned() const { return _abandoned.load(std::memory_order_acquire); }
+
+private:
+    std::unique_ptr<Entry[]> _entries;
+    std::size_t _capacity;
+
+    // ever increasing positions, separate cache lines keep producer and consumer from invalidating each other
+    alignas(64) std::atomic<std::size_t> _head;
+    alignas(64) std::atomic<std::size_t> _tail;
+    std::atomic<bool> _abandoned;
+};
+
+/*
+ * Owns one LogRingBuffer per logging thread and a background thread writing their messages to loggers.
+ */
+class TC_COMMON_API LogRingBufferWriter
+{
+public:
+    explicit LogRingBufferWriter(std::size_t capacityPerThread);
+    ~LogRingBufferWriter();
+
+    LogRingBufferWriter(LogRingBufferWriter const&) = delete;
+    LogRingBufferWriter& operator=(LogRingBufferWriter const&) = delete;
+
+    // Queues message in calling thread's buffer, returns false if it has to be written another way
+    bool Write(Logger const* logger, std::string_view filter, LogLevel level, Trinity::FormatStringView messageFormat, Trinity::FormatArgs messageFormatArgs) noexcept;
+
+    // Writes every queued message before returning, loggers must not be destroyed while messages for them are queued
+    void Flush();
+
+private:
+    LogRingBuffer* GetThreadBuffer();
+    void WriterThread();
+    std::size_t DrainAll();
+
+    std::size_t _capacityPerThread;
+    std::vector<std::shared_ptr<LogRingBuffer>> _buffers;
+    std::mutex _buffersLock;
+    std::mutex _drainLock;
+
+    uint32 _id;
+    std::atomic<uint32> _wakeUp;
+    std::atomic<bool> _stopping;
+    std::thread _thread;
+};
+
+#endif // TRINITYCORE_LOG_RING_BUFFER_H
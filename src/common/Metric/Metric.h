@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "Duration.h"
+#include "MetricsRegistry.h"
 #include "MPSCQueue.h"
 #include "Optional.h"
 #include <functional>
@@ -194,6 +195,7 @@ Optional<MetricStopWatch<LoggerType>> MakeMetricStopWatch(LoggerType&& loggerFun
 #define TC_METRIC_DETAILED_EVENT(category, title, description) ((void)0)
 #define TC_METRIC_DETAILED_TIMER(category, ...) ((void)0)
 #define TC_METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) ((void)0)
+#define TC_METRIC_HISTOGRAM_TIMER(name, help, ...) ((void)0)
 #else
 #  if TRINITY_PLATFORM != TRINITY_PLATFORM_WINDOWS
 #define TC_METRIC_EVENT(category, title, description)                  \
@@ -229,6 +231,12 @@ Optional<MetricStopWatch<LoggerType>> MakeMetricStopWatch(LoggerType&& loggerFun
         {                                                                                                        \
             sMetric->LogValue(category, std::chrono::steady_clock::now() - start, ##__VA_ARGS__);                \
         });
+// Records time until end of scope into a histogram of the in process registry, served by the metrics http endpoint
+// Histogram is looked up once per call site, labels must not change between calls
+#define TC_METRIC_HISTOGRAM_TIMER(name, help, ...)                                                               \
+        static Trinity::Metrics::Histogram& TC_METRIC_UNIQUE_NAME(__tc_metric_histogram) =                       \
+            sMetricsRegistry->GetHistogram(name, help, ##__VA_ARGS__);                                           \
+        Trinity::Metrics::HistogramTimer TC_METRIC_UNIQUE_NAME(__tc_metric_histogram_timer)(TC_METRIC_UNIQUE_NAME(__tc_metric_histogram));
 #  if defined WITH_DETAILED_METRICS
 #define TC_METRIC_DETAILED_TIMER(category, ...)                                                                  \
         auto TC_METRIC_UNIQUE_NAME(__tc_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start)            \
@@ -0,0 +1,208 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MetricsRegistry.h"
+#include "Errors.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include <cmath>
+#include <iterator>
+
+namespace Trinity::Metrics
+{
+std::size_t GetThreadShard()
+{
+    static std::atomic<std::size_t> nextShard = 0;
+    thread_local std::size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+    return shard;
+}
+
+uint64 Counter::GetValue() const
+{
+    uint64 value = 0;
+    for (Shard const& shard : _shards)
+        value += shard.Value.load(std::memory_order_relaxed);
+    return value;
+}
+
+Microseconds Histogram::Snapshot::GetQuantile(double quantile) const
+{
+    if (!Count)
+        return Microseconds::zero();
+
+    uint64 rank = std::max<uint64>(uint64(std::ceil(std::clamp(quantile, 0.0, 1.0) * double(Count))), 1);
+    uint64 seen = 0;
+    for (uint32 bucket = 0; bucket < BucketCount; ++bucket)
+    {
+        seen += Buckets[bucket];
+        if (seen >= rank)
+        {
+            // middle of the bucket, halves the worst case error compared to either bound
+            uint64 lower = GetBucketLowerBound(bucket);
+            uint64 upper = bucket + 1 < BucketCount ? GetBucketLowerBound(bucket + 1) - 1 : MaxValue;
+            return Microseconds(lower + (upper - lower) / 2);
+        }
+    }
+
+    return Microseconds(MaxValue);
+}
+
+uint64 Histogram::Snapshot::GetCountAtOrBelow(uint64 microseconds) const
+{
+    uint64 count = 0;
+    for (uint32 bucket = 0; bucket < BucketCount && GetBucketLowerBound(bucket) <= microseconds; ++bucket)
+        count += Buckets[bucket];
+    return count;
+}
+
+Histogram::Snapshot Histogram::GetSnapshot() const
+{
+    Snapshot snapshot;
+    for (std::size_t i = 0; i < ShardCount; ++i)
+    {
+        Shard const& shard = _shards[i];
+        for (uint32 bucket = 0; bucket < BucketCount; ++bucket)
+            snapshot.Buckets[bucket] += shard.Buckets[bucket].load(std::memory_order_relaxed);
+        snapshot.Sum += shard.Sum.load(std::memory_order_relaxed);
+    }
+
+    for (uint64 bucketCount : snapshot.Buckets)
+        snapshot.Count += bucketCount;
+
+    return snapshot;
+}
+
+Registry* Registry::instance()
+{
+    static Registry instance;
+    return &instance;
+}
+
+Counter& Registry::GetCounter(std::string_view name, std::string_view help, std::string_view labels)
+{
+    return *FindOrCreate(name, help, labels, MetricType::Counter).CounterMetric;
+}
+
+Gauge& Registry::GetGauge(std::string_view name, std::string_view help, std::string_view labels)
+{
+    return *FindOrCreate(name, help, labels, MetricType::Gauge).GaugeMetric;
+}
+
+Histogram& Registry::GetHistogram(std::string_view name, std::string_view help, std::string_view labels)
+{
+    return *FindOrCreate(name, help, labels, MetricType::Histogram).HistogramMetric;
+}
+
+Registry::Entry& Registry::FindOrCreate(std::string_view name, std::string_view help, std::string_view labels, MetricType type)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    for (std::unique_ptr<Entry> const& entry : _entries)
+    {
+        if (entry->Name == name && entry->Labels == labels)
+        {
+            ASSERT(entry->Type == type, "Metric " STRING_VIEW_FMT " registered with different types", STRING_VIEW_FMT_ARG(name));
+            return *entry;
+        }
+    }
+
+    Entry& entry = *_entries.emplace_back(std::make_unique<Entry>());
+    entry.Name = name;
+    entry.Help = help;
+    entry.Labels = labels;
+    entry.Type = type;
+    switch (type)
+    {
+        case MetricType::Counter:
+            entry.CounterMetric = std::make_unique<Counter>();
+            break;
+        case MetricType::Gauge:
+            entry.GaugeMetric = std::make_unique<Gauge>();
+            break;
+        case MetricType::Histogram:
+            entry.HistogramMetric = std::make_unique<Histogram>();
+            break;
+    }
+
+    return entry;
+}
+
+std::string Registry::WriteTextExposition() const
+{
+    // every recorded bucket is exported with its end as le boundary, so exported quantiles keep the precision of recorded ones
+    // recorded durations are truncated to whole microseconds so counting values below the boundary matches le semantics
+    static constexpr uint64 MaxExportedBound = uint64(1) << 26;     // ~67 seconds
+
+    std::string text;
+    auto out = std::back_inserter(text);
+    auto formatLabels = [](std::string const& labels, std::string_view extra = { })
+    {
+        if (labels.empty() && extra.empty())
+            return std::string();
+
+        return Trinity::StringFormat("{{{}{}{}}}", labels, !labels.empty() && !extra.empty() ? "," : "", extra);
+    };
+
+    std::lock_guard<std::mutex> lock(_lock);
+
+    // entries with same name share HELP and TYPE lines, keep them in registration order otherwise
+    std::vector<Entry const*> sorted;
+    sorted.reserve(_entries.size());
+    for (std::unique_ptr<Entry> const& entry : _entries)
+        sorted.push_back(entry.get());
+
+    std::ranges::stable_sort(sorted, {}, [](Entry const* entry) -> std::string const& { return entry->Name; });
+
+    std::string_view previousName;
+    for (Entry const* entry : sorted)
+    {
+        if (entry->Name != previousName)
+        {
+            static constexpr std::string_view TypeNames[] = { "counter", "gauge", "histogram" };
+            Trinity::StringFormatTo(out, "# HELP {} {}\n# TYPE {} {}\n", entry->Name, entry->Help, entry->Name, TypeNames[AsUnderlyingType(entry->Type)]);
+            previousName = entry->Name;
+        }
+
+        switch (entry->Type)
+        {
+            case MetricType::Counter:
+                Trinity::StringFormatTo(out, "{}{} {}\n", entry->Name, formatLabels(entry->Labels), entry->CounterMetric->GetValue());
+                break;
+            case MetricType::Gauge:
+                Trinity::StringFormatTo(out, "{}{} {}\n", entry->Name, formatLabels(entry->Labels), entry->GaugeMetric->GetValue());
+                break;
+            case MetricType::Histogram:
+            {
+                Histogram::Snapshot snapshot = entry->HistogramMetric->GetSnapshot();
+                for (uint32 bucket = 1; bucket < Histogram::BucketCount && Histogram::GetBucketLowerBound(bucket) <= MaxExportedBound; ++bucket)
+                {
+                    uint64 upperBound = Histogram::GetBucketLowerBound(bucket);
+                    Trinity::StringFormatTo(out, "{}_bucket{} {}\n", entry->Name,
+                        formatLabels(entry->Labels, Trinity::StringFormat("le=\"{}\"", double(upperBound) / 1000000.0)),
+                        snapshot.GetCountAtOrBelow(upperBound - 1));
+                }
+
+                Trinity::StringFormatTo(out, "{}_bucket{} {}\n", entry->Name, formatLabels(entry->Labels, "le=\"+Inf\""), snapshot.Count);
+                Trinity::StringFormatTo(out, "{}_sum{} {}\n", entry->Name, formatLabels(entry->Labels), double(snapshot.Sum) / 1000000.0);
+                Trinity::StringFormatTo(out, "{}_count{} {}\n", entry->Name, formatLabels(entry->Labels), snapshot.Count);
+                break;
+            }
+        }
+    }
+
+    return text;
+}
+}
@@ -0,0 +1,198 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_METRICS_REGISTRY_H
+#define TRINITYCORE_METRICS_REGISTRY_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Trinity::Metrics
+{
+// Updates are spread over shards picked by calling thread so threads recording the same metric do not contend on one cache line
+static constexpr std::size_t ShardCount = 16;
+
+TC_COMMON_API std::size_t GetThreadShard();
+
+class TC_COMMON_API Counter
+{
+public:
+    void Add(uint64 value = 1) { _shards[GetThreadShard()].Value.fetch_add(value, std::memory_order_relaxed); }
+
+    uint64 GetValue() const;
+
+private:
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64> Value = 0;
+    };
+
+    std::array<Shard, ShardCount> _shards;
+};
+
+class TC_COMMON_API Gauge
+{
+public:
+    void Set(int64 value) { _value.store(value, std::memory_order_relaxed); }
+    void Add(int64 value) { _value.fetch_add(value, std::memory_order_relaxed); }
+
+    int64 GetValue() const { return _value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64> _value = 0;
+};
+
+/*
+ * Latency histogram in microseconds with log-linear buckets like HdrHistogram:
+ * every power of two range is split into SubBucketCount equal buckets, so any recorded value
+ * is known within 1/SubBucketCount of itself from 1 us up to MaxValue.
+ */
+class TC_COMMON_API Histogram
+{
+public:
+    static constexpr uint32 SubBucketBits = 3;
+    static constexpr uint32 SubBucketCount = 1 << SubBucketBits;
+    static constexpr uint32 MaxExponent = 40;   // ~12 days
+    static constexpr uint64 MaxValue = (uint64(1) << (MaxExponent + 1)) - 1;
+    static constexpr uint32 BucketCount = (MaxExponent - SubBucketBits + 2) * SubBucketCount;
+
+    static constexpr uint32 GetBucket(uint64 microseconds)
+    {
+        if (microseconds < SubBucketCount)
+            return uint32(microseconds);
+
+        if (microseconds > MaxValue)
+            microseconds = MaxValue;
+
+        uint32 exponent = std::bit_width(microseconds) - 1;
+        uint32 subBucket = uint32(microseconds >> (exponent - SubBucketBits)) & (SubBucketCount - 1);
+        return (exponent - SubBucketBits + 1) * SubBucketCount + subBucket;
+    }
+
+    // smallest value stored in bucket
+    static constexpr uint64 GetBucketLowerBound(uint32 bucket)
+    {
+        if (bucket < SubBucketCount)
+            return bucket;
+
+        uint32 exponent = bucket / SubBucketCount + SubBucketBits - 1;
+        return uint64(SubBucketCount + bucket % SubBucketCount) << (exponent - SubBucketBits);
+    }
+
+    struct Snapshot
+    {
+        std::array<uint64, BucketCount> Buckets = { };
+        uint64 Count = 0;
+        uint64 Sum = 0;     // microseconds
+
+        // value below which given fraction of recorded values are, within bucket precision
+        Microseconds GetQuantile(double quantile) const;
+
+        // number of recorded values not greater than microseconds, exact when microseconds + 1 is a bucket lower bound
+        uint64 GetCountAtOrBelow(uint64 microseconds) const;
+    };
+
+    void Record(Microseconds value)
+    {
+        uint64 microseconds = uint64(std::max<Microseconds::rep>(value.count(), 0));
+        Shard& shard = _shards[GetThreadShard()];
+        shard.Buckets[GetBucket(microseconds)].fetch_add(1, std::memory_order_relaxed);
+        shard.Sum.fetch_add(microseconds, std::memory_order_relaxed);
+    }
+
+    Snapshot GetSnapshot() const;
+
+private:
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<uint64>, BucketCount> Buckets = { };
+        std::atomic<uint64> Sum = 0;
+    };
+
+    std::unique_ptr<Shard[]> _shards = std::make_unique<Shard[]>(ShardCount);
+};
+
+// Records time between construction and destruction into histogram
+class HistogramTimer
+{
+public:
+    explicit HistogramTimer(Histogram& histogram) : _histogram(histogram), _start(std::chrono::steady_clock::now()) { }
+    ~HistogramTimer() { _histogram.Record(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - _start)); }
+
+    HistogramTimer(HistogramTimer const&) = delete;
+    HistogramTimer& operator=(HistogramTimer const&) = delete;
+
+private:
+    Histogram& _histogram;
+    TimePoint _start;
+};
+
+/*
+ * Metrics registered once by name and updated in place, read by text exposition for Prometheus compatible scrapers.
+ * Registered metrics live until the process exits, references returned by Get* can be cached by callers.
+ */
+class TC_COMMON_API Registry
+{
+public:
+    static Registry* instance();
+
+    // labels are in exposition format, for example: map_id="571"
+    Counter& GetCounter(std::string_view name, std::string_view help, std::string_view labels = { });
+    Gauge& GetGauge(std::string_view name, std::string_view help, std::string_view labels = { });
+    Histogram& GetHistogram(std::string_view name, std::string_view help, std::string_view labels = { });
+
+    // Prometheus text exposition format 0.0.4, histograms are exported in seconds with their recorded buckets
+    std::string WriteTextExposition() const;
+
+private:
+    enum class MetricType
+    {
+        Counter,
+        Gauge,
+        Histogram
+    };
+
+    struct Entry
+    {
+        std::string Name;
+        std::string Help;
+        std::string Labels;
+        MetricType Type;
+        std::unique_ptr<Counter> CounterMetric;
+        std::unique_ptr<Gauge> GaugeMetric;
+        std::unique_ptr<Histogram> HistogramMetric;
+    };
+
+    Entry& FindOrCreate(std::string_view name, std::string_view help, std::string_view labels, MetricType type);
+
+    mutable std::mutex _lock;
+    std::vector<std::unique_ptr<Entry>> _entries;
+};
+}
+
+#define sMetricsRegistry Trinity::Metrics::Registry::instance()
+
+#endif // TRINITYCORE_METRICS_REGISTRY_H
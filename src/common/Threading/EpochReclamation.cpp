@@ -0,0 +1,138 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EpochReclamation.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+constexpr uint64 IdleEpoch = std::numeric_limits<uint64>::max();
+
+// one per reading thread, on its own cache line so announcing an epoch never contends
+struct alignas(64) ReaderSlot
+{
+    std::atomic<uint64> Epoch = IdleEpoch;
+    std::atomic<bool> InUse = false;
+    ReaderSlot* Next = nullptr;
+};
+
+struct RetiredObject
+{
+    void* Object;
+    void(*Deleter)(void*);
+    uint64 Epoch;
+};
+
+std::atomic<uint64> GlobalEpoch = 0;
+
+// slots are never freed, slots of finished threads are reused
+std::atomic<ReaderSlot*> Slots = nullptr;
+
+std::mutex RetiredLock;
+std::vector<RetiredObject> Retired;
+
+ReaderSlot* AcquireSlot()
+{
+    for (ReaderSlot* slot = Slots.load(std::memory_order_acquire); slot; slot = slot->Next)
+        if (!slot->InUse.load(std::memory_order_relaxed) && !slot->InUse.exchange(true, std::memory_order_acquire))
+            return slot;
+
+    ReaderSlot* slot = new ReaderSlot();
+    slot->InUse.store(true, std::memory_order_relaxed);
+    slot->Next = Slots.load(std::memory_order_relaxed);
+    while (!Slots.compare_exchange_weak(slot->Next, slot, std::memory_order_release, std::memory_order_relaxed))
+        ;
+
+    return slot;
+}
+
+struct ThreadState
+{
+    ~ThreadState()
+    {
+        if (Slot)
+            Slot->InUse.store(false, std::memory_order_release);
+    }
+
+    ReaderSlot* Slot = nullptr;
+    uint32 Depth = 0;
+};
+
+thread_local ThreadState CurrentThread;
+
+// must be called with RetiredLock held
+void ReclaimRetired()
+{
+    // pairs with the fence in ReadGuard - readers not seen here will see every replacement published before
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    uint64 oldestEpoch = IdleEpoch;
+    for (ReaderSlot* slot = Slots.load(std::memory_order_acquire); slot; slot = slot->Next)
+        oldestEpoch = std::min(oldestEpoch, slot->Epoch.load(std::memory_order_acquire));
+
+    auto end = std::partition(Retired.begin(), Retired.end(), [oldestEpoch](RetiredObject const& retired) { return retired.Epoch >= oldestEpoch; });
+    for (auto itr = end; itr != Retired.end(); ++itr)
+        itr->Deleter(itr->Object);
+
+    Retired.erase(end, Retired.end());
+}
+}
+
+Trinity::EpochReclamation::ReadGuard::ReadGuard()
+{
+    ThreadState& state = CurrentThread;
+    if (state.Depth++)
+        return;
+
+    if (!state.Slot)
+        state.Slot = AcquireSlot();
+
+    state.Slot->Epoch.store(GlobalEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+Trinity::EpochReclamation::ReadGuard::~ReadGuard()
+{
+    ThreadState& state = CurrentThread;
+    if (--state.Depth)
+        return;
+
+    state.Slot->Epoch.store(IdleEpoch, std::memory_order_release);
+}
+
+void Trinity::EpochReclamation::Retire(void* object, void(*deleter)(void*))
+{
+    // orders publication of the replacement before scanning reader slots
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::lock_guard<std::mutex> lock(RetiredLock);
+
+    // readers that announce a later epoch can only see the replacement
+    Retired.push_back({ object, deleter, GlobalEpoch.fetch_add(1, std::memory_order_acq_rel) });
+    ReclaimRetired();
+}
+
+std::size_t Trinity::EpochReclamation::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(RetiredLock);
+    ReclaimRetired();
+    return Retired.size();
+}
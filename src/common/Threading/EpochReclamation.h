@@ -0,0 +1,60 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_EPOCH_RECLAMATION_H
+#define TRINITYCORE_EPOCH_RECLAMATION_H
+
+#include "Define.h"
+
+namespace Trinity
+{
+/*
+ * Epoch based reclamation for data structures read without locks.
+ * Readers wrap every access in a ReadGuard, which only writes a per thread slot.
+ * Writers replace objects atomically and Retire the old ones, they are destroyed once
+ * every reader that could still be using them has left its ReadGuard.
+ */
+class TC_COMMON_API EpochReclamation
+{
+public:
+    EpochReclamation() = delete;
+
+    class TC_COMMON_API ReadGuard
+    {
+    public:
+        ReadGuard();
+        ~ReadGuard();
+
+        ReadGuard(ReadGuard const&) = delete;
+        ReadGuard& operator=(ReadGuard const&) = delete;
+    };
+
+    // object must already be unreachable for readers entering a ReadGuard after this call
+    static void Retire(void* object, void(*deleter)(void*));
+
+    template <typename T>
+    static void Retire(T const* object)
+    {
+        Retire(const_cast<T*>(object), [](void* ptr) { delete static_cast<T*>(ptr); });
+    }
+
+    // Number of retired objects still waiting for readers
+    static std::size_t GetPendingCount();
+};
+}
+
+#endif // TRINITYCORE_EPOCH_RECLAMATION_H
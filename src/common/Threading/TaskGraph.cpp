@@ -0,0 +1,123 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskGraph.h"
+#include "Errors.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+Trinity::TaskGraph::TaskId Trinity::TaskGraph::AddTask(std::string name, std::function<void()> work, std::initializer_list<TaskId> dependencies)
+{
+    TaskId id = _tasks.size();
+    for (TaskId dependency : dependencies)
+    {
+        ASSERT(dependency < id, "Task %s can only depend on tasks added before it", name.c_str());
+        _tasks[dependency].Dependents.push_back(id);
+    }
+
+    Task& task = _tasks.emplace_back();
+    task.Name = std::move(name);
+    task.Work = std::move(work);
+    task.Dependencies = dependencies;
+    return id;
+}
+
+Trinity::TaskGraph::Timings Trinity::TaskGraph::Run(std::size_t threads)
+{
+    TimePoint start = std::chrono::steady_clock::now();
+
+    auto runTask = [](Task& task)
+    {
+        TimePoint taskStart = std::chrono::steady_clock::now();
+        task.Work();
+        task.Duration = std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - taskStart);
+    };
+
+    if (threads > 1)
+    {
+        std::unique_ptr<std::atomic<std::size_t>[]> pendingDependencies = std::make_unique<std::atomic<std::size_t>[]>(_tasks.size());
+        for (TaskId id = 0; id < _tasks.size(); ++id)
+            pendingDependencies[id] = _tasks[id].Dependencies.size();
+
+        ThreadPool pool(threads);
+        std::function<void(TaskId)> post = [&](TaskId id)
+        {
+            pool.PostWork([&, id]()
+            {
+                runTask(_tasks[id]);
+
+                // last finished dependency starts the dependent task
+                for (TaskId dependent : _tasks[id].Dependents)
+                    if (pendingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        post(dependent);
+            });
+        };
+
+        for (TaskId id = 0; id < _tasks.size(); ++id)
+            if (_tasks[id].Dependencies.empty())
+                post(id);
+
+        pool.Join();
+    }
+    else
+        for (Task& task : _tasks)
+            runTask(task);
+
+    Timings timings;
+    timings.Total = std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - start);
+
+    // tasks are in topological order, longest chain ending in each task only needs chains of earlier tasks
+    std::vector<Milliseconds> chainDurations(_tasks.size());
+    std::vector<TaskId> chainPrevious(_tasks.size());
+    for (TaskId id = 0; id < _tasks.size(); ++id)
+    {
+        chainPrevious[id] = id;
+        Milliseconds longestDependency = Milliseconds::zero();
+        for (TaskId dependency : _tasks[id].Dependencies)
+        {
+            if (chainDurations[dependency] >= longestDependency)
+            {
+                longestDependency = chainDurations[dependency];
+                chainPrevious[id] = dependency;
+            }
+        }
+
+        chainDurations[id] = longestDependency + _tasks[id].Duration;
+        timings.Serial += _tasks[id].Duration;
+    }
+
+    auto longest = std::ranges::max_element(chainDurations);
+    if (longest != chainDurations.end())
+    {
+        timings.CriticalPath = *longest;
+        TaskId id = TaskId(std::distance(chainDurations.begin(), longest));
+        while (true)
+        {
+            timings.CriticalPathTasks.push_back(_tasks[id].Name);
+            if (chainPrevious[id] == id)
+                break;
+
+            id = chainPrevious[id];
+        }
+
+        std::ranges::reverse(timings.CriticalPathTasks);
+    }
+
+    return timings;
+}
@@ -0,0 +1,67 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_TASK_GRAPH_H
+#define TRINITYCORE_TASK_GRAPH_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace Trinity
+{
+/*
+ * Runs tasks as soon as all tasks they depend on are finished, on a thread pool.
+ * Tasks can only depend on tasks added before them, which keeps the graph acyclic
+ * and makes the order they were added in a valid order to run them on a single thread.
+ */
+class TC_COMMON_API TaskGraph
+{
+public:
+    typedef std::size_t TaskId;
+
+    struct Timings
+    {
+        Milliseconds Total = Milliseconds::zero();
+        Milliseconds Serial = Milliseconds::zero();        // sum of task durations, what running them one after another would take
+        Milliseconds CriticalPath = Milliseconds::zero();  // longest chain of dependent tasks, lower bound of Total with unlimited threads
+        std::vector<std::string> CriticalPathTasks;
+    };
+
+    TaskId AddTask(std::string name, std::function<void()> work, std::initializer_list<TaskId> dependencies = { });
+
+    // runs every task once, threads <= 1 runs them in the order they were added on the calling thread
+    Timings Run(std::size_t threads);
+
+private:
+    struct Task
+    {
+        std::string Name;
+        std::function<void()> Work;
+        std::vector<TaskId> Dependencies;
+        std::vector<TaskId> Dependents;
+        Milliseconds Duration = Milliseconds::zero();
+    };
+
+    std::vector<Task> _tasks;
+};
+}
+
+#endif // TRINITYCORE_TASK_GRAPH_H
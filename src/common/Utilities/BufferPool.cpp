@@ -0,0 +1,229 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BufferPool.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <mutex>
+
+namespace
+{
+using Trinity::BufferPool;
+using FreeList = std::vector<std::vector<uint8>>;
+
+constexpr std::size_t ThreadCacheBytesPerClass = 128 * 1024;  // free storage per class kept by each thread
+constexpr std::size_t ThreadCacheMaxSize = 32;                  // free buffers per class kept by each thread
+
+std::atomic<std::size_t> DepotCapacity = BufferPool::DefaultDepotCapacity;
+
+std::atomic<uint64> Allocations;
+std::atomic<uint64> Reuses;
+std::atomic<uint64> Discards;
+
+// statics and thread locals can be destroyed before the last buffer is released during shutdown
+std::atomic<bool> DepotDestroyed = false;
+thread_local bool ThreadCacheDestroyed = false;
+
+struct Depot
+{
+    ~Depot() { DepotDestroyed = true; }
+
+    std::mutex Lock;
+    std::array<FreeList, BufferPool::ClassCount> Buffers;
+    std::size_t Bytes = 0;      // sum of capacities of all buffers in Buffers
+};
+
+// large classes keep fewer buffers so that a thread never holds more than ThreadCacheBytesPerClass of each
+constexpr std::size_t GetThreadCacheSize(std::size_t sizeClass)
+{
+    return std::clamp<std::size_t>(ThreadCacheBytesPerClass / (BufferPool::MinClassSize << sizeClass), 2, ThreadCacheMaxSize);
+}
+
+// buffers moved between thread cache and depot at once
+constexpr std::size_t GetTransferBatchSize(std::size_t sizeClass)
+{
+    return GetThreadCacheSize(sizeClass) / 2;
+}
+
+struct ThreadCache
+{
+    ThreadCache()
+    {
+        for (std::size_t sizeClass = 0; sizeClass < BufferPool::ClassCount; ++sizeClass)
+            Buffers[sizeClass].reserve(GetThreadCacheSize(sizeClass));
+    }
+
+    ~ThreadCache() { ThreadCacheDestroyed = true; }
+
+    std::array<FreeList, BufferPool::ClassCount> Buffers;
+};
+
+Depot& GetDepot()
+{
+    static Depot depot;
+    return depot;
+}
+
+thread_local ThreadCache Cache;
+
+// smallest class able to hold size bytes
+std::size_t GetAcquireClass(std::size_t size)
+{
+    if (size <= BufferPool::MinClassSize)
+        return 0;
+
+    return std::bit_width(size - 1) - std::bit_width(BufferPool::MinClassSize - 1);
+}
+
+// largest class that fits in capacity
+std::size_t GetReleaseClass(std::size_t capacity)
+{
+    return std::min<std::size_t>(std::bit_width(capacity) - std::bit_width(BufferPool::MinClassSize), BufferPool::ClassCount - 1);
+}
+
+void RefillFromDepot(std::size_t sizeClass, FreeList& cached)
+{
+    if (DepotDestroyed)
+        return;
+
+    Depot& depot = GetDepot();
+    std::lock_guard<std::mutex> lock(depot.Lock);
+    FreeList& shared = depot.Buffers[sizeClass];
+    std::size_t count = std::min(shared.size(), GetTransferBatchSize(sizeClass));
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        depot.Bytes -= shared.back().capacity();
+        cached.push_back(std::move(shared.back()));
+        shared.pop_back();
+    }
+}
+
+void FlushToDepot(std::size_t sizeClass, FreeList& cached)
+{
+    std::size_t count = GetTransferBatchSize(sizeClass);
+    if (!DepotDestroyed)
+    {
+        Depot& depot = GetDepot();
+        std::size_t capacity = DepotCapacity.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(depot.Lock);
+        FreeList& shared = depot.Buffers[sizeClass];
+        for (; count && depot.Bytes + cached.back().capacity() <= capacity; --count)
+        {
+            depot.Bytes += cached.back().capacity();
+            shared.push_back(std::move(cached.back()));
+            cached.pop_back();
+        }
+    }
+
+    Discards.fetch_add(count, std::memory_order_relaxed);
+    cached.resize(cached.size() - count);
+}
+}
+
+std::vector<uint8> Trinity::BufferPool::Acquire(std::size_t size)
+{
+    std::vector<uint8> buffer;
+    if (!size)
+        return buffer;
+
+    if (size > MaxClassSize || ThreadCacheDestroyed)
+    {
+        Allocations.fetch_add(1, std::memory_order_relaxed);
+        buffer.reserve(size);
+        return buffer;
+    }
+
+    std::size_t sizeClass = GetAcquireClass(size);
+    FreeList& cached = Cache.Buffers[sizeClass];
+    if (cached.empty())
+        RefillFromDepot(sizeClass, cached);
+
+    if (!cached.empty())
+    {
+        Reuses.fetch_add(1, std::memory_order_relaxed);
+        buffer = std::move(cached.back());
+        cached.pop_back();
+        return buffer;
+    }
+
+    Allocations.fetch_add(1, std::memory_order_relaxed);
+    buffer.reserve(MinClassSize << sizeClass);
+    return buffer;
+}
+
+void Trinity::BufferPool::Release(std::vector<uint8>&& buffer)
+{
+    std::size_t capacity = buffer.capacity();
+    if (capacity < MinClassSize)
+        return;
+
+    if (capacity >= MaxClassSize * 2 || ThreadCacheDestroyed)
+    {
+        Discards.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    std::size_t sizeClass = GetReleaseClass(capacity);
+    FreeList& cached = Cache.Buffers[sizeClass];
+    if (cached.size() >= GetThreadCacheSize(sizeClass))
+        FlushToDepot(sizeClass, cached);
+
+    buffer.clear();
+    cached.push_back(std::move(buffer));
+}
+
+Trinity::BufferPool::Statistics Trinity::BufferPool::GetStatistics()
+{
+    uint64 depotBytes = 0;
+    if (!DepotDestroyed)
+    {
+        Depot& depot = GetDepot();
+        std::lock_guard<std::mutex> lock(depot.Lock);
+        depotBytes = depot.Bytes;
+    }
+
+    return
+    {
+        .Allocations = Allocations.load(std::memory_order_relaxed),
+        .Reuses = Reuses.load(std::memory_order_relaxed),
+        .Discards = Discards.load(std::memory_order_relaxed),
+        .DepotBytes = depotBytes
+    };
+}
+
+void Trinity::BufferPool::SetDepotCapacity(std::size_t bytes)
+{
+    DepotCapacity.store(bytes, std::memory_order_relaxed);
+    if (DepotDestroyed)
+        return;
+
+    // free largest buffers first, they are the least likely to be needed again
+    Depot& depot = GetDepot();
+    std::lock_guard<std::mutex> lock(depot.Lock);
+    for (std::size_t sizeClass = ClassCount; sizeClass > 0 && depot.Bytes > bytes; --sizeClass)
+    {
+        FreeList& shared = depot.Buffers[sizeClass - 1];
+        while (!shared.empty() && depot.Bytes > bytes)
+        {
+            depot.Bytes -= shared.back().capacity();
+            shared.pop_back();
+            Discards.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_BUFFER_POOL_H
+#define TRINITYCORE_BUFFER_POOL_H
+
+#include "Define.h"
+#include <vector>
+
+namespace Trinity
+{
+/*
+ * Pool of byte storage used by ByteBuffer, WorldPacket and MessageBuffer, split into power of two size classes.
+ * Every thread keeps a small cache of free buffers per class, surplus is exchanged in batches with a global depot
+ * so that buffers allocated by one thread (packet builders) and freed by another (network threads) are recycled too.
+ */
+class TC_COMMON_API BufferPool
+{
+public:
+    static constexpr std::size_t MinClassSize = 256;
+    static constexpr std::size_t ClassCount = 9;
+    static constexpr std::size_t MaxClassSize = MinClassSize << (ClassCount - 1);
+
+    static constexpr std::size_t DefaultDepotCapacity = 16 * 1024 * 1024;
+
+    struct Statistics
+    {
+        uint64 Allocations = 0;     ///< requests that had to allocate new storage
+        uint64 Reuses = 0;          ///< requests served from the pool
+        uint64 Discards = 0;        ///< released buffers freed because the pool was full or they were too large
+        uint64 DepotBytes = 0;      ///< capacity of free buffers currently held by the depot
+    };
+
+    // Returns empty storage with capacity of at least size
+    static std::vector<uint8> Acquire(std::size_t size);
+
+    // Takes storage back, its contents are discarded
+    static void Release(std::vector<uint8>&& buffer);
+
+    static Statistics GetStatistics();
+
+    // Limits total capacity of free buffers kept by the depot, surplus is freed immediately when lowered
+    // Thread caches are bounded separately to well below 1 MiB per thread
+    static void SetDepotCapacity(std::size_t bytes);
+};
+}
+
+#endif // TRINITYCORE_BUFFER_POOL_H
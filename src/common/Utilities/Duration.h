@@ -20,6 +20,9 @@
 
 #include <chrono>
 
+/// Microseconds shorthand typedef.
+using Microseconds = std::chrono::microseconds;
+
 /// Milliseconds shorthand typedef.
 using Milliseconds = std::chrono::milliseconds;
 using FloatMilliseconds = std::chrono::duration<float, Milliseconds::period>;
@@ -0,0 +1,114 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MappedFile.h"
+
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+std::size_t GetPageSize()
+{
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    return systemInfo.dwPageSize;
+#else
+    long pageSize = sysconf(_SC_PAGESIZE);
+    return pageSize > 0 ? std::size_t(pageSize) : 4096;
+#endif
+}
+}
+
+std::unique_ptr<Trinity::MappedFile> Trinity::MappedFile::Open(char const* fileName, Access access)
+{
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, access == Access::CopyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return nullptr;
+
+    // view keeps the mapping object alive
+    void* data = MapViewOfFile(mapping, access == Access::CopyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data)
+        return nullptr;
+
+    return std::unique_ptr<MappedFile>(new MappedFile(static_cast<uint8*>(data), std::size_t(fileSize.QuadPart), access));
+#else
+    int fd = open(fileName, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    int protection = access == Access::CopyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* data = mmap(nullptr, std::size_t(fileStat.st_size), protection, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    return std::unique_ptr<MappedFile>(new MappedFile(static_cast<uint8*>(data), std::size_t(fileStat.st_size), access));
+#endif
+}
+
+bool Trinity::MappedFile::Prefetch(char const* fileName)
+{
+    std::unique_ptr<MappedFile> file = Open(fileName);
+    if (!file)
+        return false;
+
+    // touching one byte of every page faults the whole file in
+    static std::size_t const PageSize = GetPageSize();
+    uint8 const volatile* data = file->_data;
+    for (std::size_t offset = 0; offset < file->_size; offset += PageSize)
+        (void)data[offset];
+
+    return true;
+}
+
+Trinity::MappedFile::~MappedFile()
+{
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+    UnmapViewOfFile(_data);
+#else
+    munmap(_data, _size);
+#endif
+}
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MAPPED_FILE_H
+#define TRINITYCORE_MAPPED_FILE_H
+
+#include "Define.h"
+#include <memory>
+#include <span>
+
+namespace Trinity
+{
+/*
+ * Whole file mapped into memory.
+ * Pages are backed by the OS page cache, so every process mapping the same file shares them
+ * until a CopyOnWrite mapping writes to a page, which then becomes private to that process.
+ * The file must not be modified while mapped - pages not yet written see the new contents
+ * and accessing pages past the end of a truncated file raises SIGBUS.
+ */
+class TC_COMMON_API MappedFile
+{
+public:
+    enum class Access
+    {
+        ReadOnly,
+        CopyOnWrite
+    };
+
+    // Returns nullptr if the file does not exist, is empty or cannot be mapped
+    static std::unique_ptr<MappedFile> Open(char const* fileName, Access access = Access::ReadOnly);
+
+    // Reads the file into the OS page cache, later reads and mappings of it do not wait for the disk
+    // Returns false if the file cannot be mapped
+    static bool Prefetch(char const* fileName);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    std::span<uint8 const> GetData() const { return { _data, _size }; }
+
+    // Only valid for CopyOnWrite mappings
+    uint8* GetWritableData() { return _access == Access::CopyOnWrite ? _data : nullptr; }
+
+    std::size_t GetSize() const { return _size; }
+
+private:
+    MappedFile(uint8* data, std::size_t size, Access access) : _data(data), _size(size), _access(access) { }
+
+    uint8* _data;
+    std::size_t _size;
+    Access _access;
+};
+}
+
+#endif // TRINITYCORE_MAPPED_FILE_H
@@ -18,7 +18,9 @@
 #ifndef TRINITYCORE_MESSAGE_BUFFER_H
 #define TRINITYCORE_MESSAGE_BUFFER_H
 
+#include "BufferPool.h"
 #include "Define.h"
+#include <utility>
 #include <vector>
 #include <cstring>
 
@@ -27,20 +29,23 @@ class MessageBuffer
     typedef std::vector<uint8>::size_type size_type;
 
 public:
-    MessageBuffer() : _wpos(0), _rpos(0), _storage()
+    MessageBuffer() : MessageBuffer(4096)
     {
-        _storage.resize(4096);
     }
 
-    explicit MessageBuffer(std::size_t initialSize) : _wpos(0), _rpos(0), _storage(initialSize)
+    explicit MessageBuffer(std::size_t initialSize) : _wpos(0), _rpos(0), _storage(Trinity::BufferPool::Acquire(initialSize))
     {
+        _storage.resize(initialSize);
     }
 
     MessageBuffer(MessageBuffer const& right) = default;
 
     MessageBuffer(MessageBuffer&& right) noexcept : _wpos(right._wpos), _rpos(right._rpos), _storage(std::move(right).Release()) { }
 
-    ~MessageBuffer() = default;
+    ~MessageBuffer()
+    {
+        Trinity::BufferPool::Release(std::move(_storage));
+    }
 
     void Reset()
     {
@@ -50,6 +55,9 @@ public:
 
     void Resize(size_type bytes)
     {
+        if (bytes > _storage.capacity())
+            Reallocate(bytes);
+
         _storage.resize(bytes);
     }
 
@@ -87,7 +95,7 @@ public:
     {
         // resize buffer if it's already full
         if (GetRemainingSpace() == 0)
-            _storage.resize(_storage.size() * 3 / 2);
+            Resize(_storage.size() * 3 / 2);
     }
 
     void Write(void const* data, std::size_t size)
@@ -113,13 +121,20 @@ public:
         {
             _wpos = right._wpos;
             _rpos = right._rpos;
-            _storage = std::move(right).Release();
+            Trinity::BufferPool::Release(std::exchange(_storage, std::move(right).Release()));
         }
 
         return *this;
     }
 
 private:
+    void Reallocate(size_type capacity)
+    {
+        std::vector<uint8> storage = Trinity::BufferPool::Acquire(capacity);
+        storage.assign(_storage.begin(), _storage.end());
+        Trinity::BufferPool::Release(std::exchange(_storage, std::move(storage)));
+    }
+
     size_type _wpos;
     size_type _rpos;
     std::vector<uint8> _storage;
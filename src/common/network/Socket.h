@@ -22,15 +22,19 @@
 #include "IpAddress.h"
 #include "Log.h"
 #include "MessageBuffer.h"
+#include "MetricsRegistry.h"
 #include "SocketConnectionInitializer.h"
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/container/static_vector.hpp>
 #include <atomic>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <type_traits>
 
 #define READ_BLOCK_SIZE 4096
+#define WRITE_GATHER_MAX_BUFFERS 64     // max queued buffers submitted by single write call
+#define WRITE_GATHER_MAX_BYTES 0x10000  // queued buffers are not added to a write call once it reaches this size
 #ifdef BOOST_ASIO_HAS_IOCP
 #define TC_SOCKET_USE_IOCP
 #endif
@@ -52,6 +56,27 @@ inline boost::asio::mutable_buffer PrepareReadBuffer(MessageBuffer& readBuffer)
     return boost::asio::buffer(readBuffer.GetWritePointer(), readBuffer.GetRemainingSpace());
 }
 
+struct SocketWriteStatistics
+{
+    uint64 Calls = 0;       ///< completed write calls
+    uint64 Bytes = 0;       ///< bytes written
+    uint64 Buffers = 0;     ///< queued buffers submitted to write calls
+};
+
+// Totals of all sockets, bytes and buffers per write call are their rates divided by the rate of calls
+struct SocketWriteMetrics
+{
+    Trinity::Metrics::Counter& Calls = sMetricsRegistry->GetCounter("trinity_socket_write_calls_total", "Completed socket write calls");
+    Trinity::Metrics::Counter& Bytes = sMetricsRegistry->GetCounter("trinity_socket_write_bytes_total", "Bytes written by socket write calls");
+    Trinity::Metrics::Counter& Buffers = sMetricsRegistry->GetCounter("trinity_socket_write_buffers_total", "Queued buffers submitted to socket write calls");
+
+    static SocketWriteMetrics& Instance()
+    {
+        static SocketWriteMetrics metrics;
+        return metrics;
+    }
+};
+
 template <typename Callable>
 concept SocketReadCallback = Trinity::invocable_r<Callable, SocketReadCallbackResult>;
 
@@ -187,7 +212,7 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef TC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -207,6 +232,9 @@ public:
             TC_LOG_DEBUG("network", "Socket::CloseSocket: {} errored when shutting down socket: {} ({})", GetRemoteIpAddress(),
                 shutdownError.value(), shutdownError.message());
 
+        TC_LOG_DEBUG("network", "Socket::CloseSocket: {} sent {} bytes in {} buffers using {} write calls", GetRemoteIpAddress(),
+            _writeStatistics.Bytes, _writeStatistics.Buffers, _writeStatistics.Calls);
+
         this->OnClose();
     }
 
@@ -240,8 +268,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef TC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()),
+        PrepareWriteBuffers();
+        _socket.async_write_some(_writeBuffers,
             [self = this->shared_from_this()](boost::system::error_code const& error, std::size_t transferedBytes)
             {
                 self->WriteHandler(error, transferedBytes);
@@ -267,6 +295,50 @@ protected:
     }
 
 private:
+    // Collects queued buffers for a single gather write, returns total number of bytes
+    std::size_t PrepareWriteBuffers()
+    {
+        std::size_t bytesToSend = 0;
+        _writeBuffers.clear();
+        for (MessageBuffer& buffer : _writeQueue)
+        {
+            if (_writeBuffers.size() == _writeBuffers.capacity() || (bytesToSend && bytesToSend + buffer.GetActiveSize() > WRITE_GATHER_MAX_BYTES))
+                break;
+
+            _writeBuffers.emplace_back(buffer.GetReadPointer(), buffer.GetActiveSize());
+            bytesToSend += buffer.GetActiveSize();
+        }
+
+        return bytesToSend;
+    }
+
+    // Removes fully written buffers from queue
+    void WriteCompleted(std::size_t bytesSent)
+    {
+        ++_writeStatistics.Calls;
+        _writeStatistics.Bytes += bytesSent;
+        _writeStatistics.Buffers += _writeBuffers.size();
+
+        SocketWriteMetrics& metrics = SocketWriteMetrics::Instance();
+        metrics.Calls.Add();
+        metrics.Bytes.Add(bytesSent);
+        metrics.Buffers.Add(_writeBuffers.size());
+
+        while (bytesSent)
+        {
+            MessageBuffer& buffer = _writeQueue.front();
+            std::size_t bufferSize = buffer.GetActiveSize();
+            if (bytesSent < bufferSize)
+            {
+                buffer.ReadCompleted(bytesSent);
+                break;
+            }
+
+            bytesSent -= bufferSize;
+            _writeQueue.pop_front();
+        }
+    }
+
     bool ReadHandlerInternal(boost::system::error_code const& error, size_t transferredBytes)
     {
         if (error)
@@ -286,9 +358,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            WriteCompleted(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -312,37 +382,33 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = PrepareWriteBuffers();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_writeBuffers, error);
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
                 return AsyncProcessQueue();
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_openState == OpenState_Closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_openState == OpenState_Closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
-        {
-            queuedMessage.ReadCompleted(bytesSent);
+
+        WriteCompleted(bytesSent);
+        if (bytesSent < bytesToSend) // now n > 0
             return AsyncProcessQueue();
-        }
 
-        _writeQueue.pop();
         if (_openState == OpenState_Closing && _writeQueue.empty())
             CloseSocket();
         return !_writeQueue.empty();
@@ -356,7 +422,9 @@ private:
     uint16 _remotePort = 0;
 
     MessageBuffer _readBuffer = MessageBuffer(READ_BLOCK_SIZE);
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+    boost::container::static_vector<boost::asio::const_buffer, WRITE_GATHER_MAX_BUFFERS> _writeBuffers;
+    SocketWriteStatistics _writeStatistics;
 
     // Socket open state "enum" (not enum to enable integral std::atomic api)
     static constexpr uint8 OpenState_Open       = 0x0;
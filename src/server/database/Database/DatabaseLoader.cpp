@@ -54,6 +54,7 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         uint8 const synchThreads = uint8(sConfigMgr->GetIntDefault(name + "Database.SynchThreads", 1));
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetMaxBatchStatements(uint32(sConfigMgr->GetIntDefault(name + "Database.MaxBatchStatements", 500)));
         if (uint32 error = pool.Open())
         {
             // Database does not exist
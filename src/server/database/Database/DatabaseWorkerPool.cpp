@@ -108,9 +108,24 @@ private:
     DatabaseWorkerPool* _pool;
 };
 
+template<typename T>
+struct DatabaseWorkerPool<T>::StatementBatch
+{
+    struct Item
+    {
+        SQLTransaction<T> Transaction;
+        bool Standalone;                    // queued with Execute, not CommitTransaction
+        QueueSizeTracker Tracker;
+    };
+
+    std::vector<Item> Items;
+    std::size_t Statements = 0;
+};
+
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool()
-    : _async_threads(0), _synch_threads(0)
+    : _async_threads(0), _synch_threads(0), _maxBatchStatements(0),
+    _batchCount(0), _batchItemCount(0), _batchExecutionTime(0)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -177,6 +192,8 @@ void DatabaseWorkerPool<T>::Close()
     if (_ioContext)
         _ioContext->stop();
 
+    _openBatch = nullptr;
+
     //! Closes the actualy MySQL connection.
     _connections[IDX_ASYNC].clear();
 
@@ -195,6 +212,32 @@ void DatabaseWorkerPool<T>::Close()
     TC_LOG_INFO("sql.driver", "All connections on DatabasePool '{}' closed.", GetDatabaseName());
 }
 
+template <class T>
+uint8 DatabaseWorkerPool<T>::ReserveSynchConnections(uint8 count)
+{
+    while (_connections[IDX_SYNCH].size() < count)
+    {
+        std::unique_ptr<T> connection = std::make_unique<T>(*_connectionInfo, CONNECTION_SYNCH);
+        if (connection->Open() || !connection->PrepareStatements())
+        {
+            TC_LOG_WARN("sql.driver", "DatabasePool '{}' could not open more synchronous connections, using {} of requested {}.",
+                GetDatabaseName(), _connections[IDX_SYNCH].size(), count);
+            break;
+        }
+
+        _connections[IDX_SYNCH].push_back(std::move(connection));
+    }
+
+    return uint8(_connections[IDX_SYNCH].size());
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::ReleaseSynchConnections()
+{
+    if (_connections[IDX_SYNCH].size() > _synch_threads)
+        _connections[IDX_SYNCH].erase(_connections[IDX_SYNCH].begin() + _synch_threads, _connections[IDX_SYNCH].end());
+}
+
 template <class T>
 bool DatabaseWorkerPool<T>::PrepareStatements()
 {
@@ -267,7 +310,7 @@ PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
 template <class T>
 QueryCallback DatabaseWorkerPool<T>::AsyncQuery(char const* sql)
 {
-    std::future<QueryResult> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, sql = std::string(sql), tracker = QueueSizeTracker(this)]
+    std::future<QueryResult> result = Post(boost::asio::use_future([this, sql = std::string(sql), tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
         return BasicStatementTask::Query(conn, sql.c_str());
@@ -278,7 +321,7 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(char const* sql)
 template <class T>
 QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 {
-    std::future<PreparedQueryResult> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this)]
+    std::future<PreparedQueryResult> result = Post(boost::asio::use_future([this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
         return PreparedStatementTask::Query(conn, stmt.get());
@@ -289,7 +332,7 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 template <class T>
 SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
 {
-    std::future<void> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, holder, tracker = QueueSizeTracker(this)]
+    std::future<void> result = Post(boost::asio::use_future([this, holder, tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
         SQLQueryHolderTask::Execute(conn, holder.get());
@@ -323,7 +366,13 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // TRINITY_DEBUG
 
-    boost::asio::post(_ioContext->get_executor(), [this, transaction, tracker = QueueSizeTracker(this)]
+    if (_maxBatchStatements > 1)
+    {
+        EnqueueBatched(std::move(transaction), false);
+        return;
+    }
+
+    Post([this, transaction, tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
         TransactionTask::Execute(conn, transaction);
@@ -350,7 +399,7 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
     }
 #endif // TRINITY_DEBUG
 
-    std::future<bool> result = boost::asio::post(_ioContext->get_executor(), boost::asio::use_future([this, transaction, tracker = QueueSizeTracker(this)]
+    std::future<bool> result = Post(boost::asio::use_future([this, transaction, tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
         return TransactionTask::Execute(conn, transaction);
@@ -425,7 +474,7 @@ void DatabaseWorkerPool<T>::KeepAlive()
     auto const count = _connections[IDX_ASYNC].size();
     for (uint8 i = 0; i < count; ++i)
     {
-        boost::asio::post(_ioContext->get_executor(), [this, tracker = QueueSizeTracker(this)]
+        Post([this, tracker = QueueSizeTracker(this)]
         {
             T* conn = GetAsyncConnectionForCurrentThread();
             conn->Ping();
@@ -496,6 +545,16 @@ size_t DatabaseWorkerPool<T>::QueueSize() const
     return _queueSize;
 }
 
+template <class T>
+typename DatabaseWorkerPool<T>::BatchStatistics DatabaseWorkerPool<T>::ConsumeBatchStatistics()
+{
+    BatchStatistics statistics;
+    statistics.Batches = _batchCount.exchange(0, std::memory_order_relaxed);
+    statistics.Items = _batchItemCount.exchange(0, std::memory_order_relaxed);
+    statistics.ExecutionTime = std::chrono::microseconds(_batchExecutionTime.exchange(0, std::memory_order_relaxed));
+    return statistics;
+}
+
 template <class T>
 T* DatabaseWorkerPool<T>::GetFreeConnection()
 {
@@ -538,13 +597,103 @@ char const* DatabaseWorkerPool<T>::GetDatabaseName() const
     return _connectionInfo->database.c_str();
 }
 
+template <class T>
+template <typename Task>
+auto DatabaseWorkerPool<T>::Post(Task&& task)
+{
+    std::lock_guard<std::mutex> lock(_batchLock);
+    _openBatch = nullptr;
+    return boost::asio::post(_ioContext->get_executor(), std::forward<Task>(task));
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::EnqueueBatched(SQLTransaction<T> transaction, bool standalone)
+{
+    std::size_t statements = transaction->GetSize();
+
+    // batch is posted under the lock, so it keeps the queue position of its first item
+    // and later items are executed before anything posted after them
+    std::lock_guard<std::mutex> lock(_batchLock);
+    if (_openBatch && _openBatch->Statements + statements <= _maxBatchStatements)
+    {
+        _openBatch->Items.push_back({ .Transaction = std::move(transaction), .Standalone = standalone, .Tracker = QueueSizeTracker(this) });
+        _openBatch->Statements += statements;
+        return;
+    }
+
+    std::shared_ptr<StatementBatch> batch = std::make_shared<StatementBatch>();
+    batch->Items.push_back({ .Transaction = std::move(transaction), .Standalone = standalone, .Tracker = QueueSizeTracker(this) });
+    batch->Statements = statements;
+    _openBatch = statements < _maxBatchStatements ? batch : nullptr;
+
+    boost::asio::post(_ioContext->get_executor(), [this, batch = std::move(batch)]
+    {
+        // close the batch before executing it, items queued from now on start a new one
+        {
+            std::lock_guard<std::mutex> lock(_batchLock);
+            if (_openBatch == batch)
+                _openBatch = nullptr;
+        }
+
+        ExecuteBatch(*batch);
+    });
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::ExecuteBatch(StatementBatch& batch)
+{
+    T* conn = GetAsyncConnectionForCurrentThread();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // commit everything at once, a single failed item rolls back the whole batch
+    // which is then executed again item by item to keep the outcome of separate execution
+    bool committed = false;
+    if (batch.Items.size() > 1)
+    {
+        std::vector<std::shared_ptr<TransactionBase>> transactions;
+        transactions.reserve(batch.Items.size());
+        for (typename StatementBatch::Item const& item : batch.Items)
+            transactions.push_back(item.Transaction);
+
+        committed = !conn->ExecuteTransactions(transactions);
+        if (!committed)
+            TC_LOG_WARN("sql.sql", "Batch of {} statements on DatabasePool '{}' failed, executing them separately.", batch.Statements, GetDatabaseName());
+    }
+
+    if (!committed)
+    {
+        for (typename StatementBatch::Item const& item : batch.Items)
+        {
+            if (item.Standalone)
+                std::visit([conn](auto&& data) { conn->Execute(TransactionData::ToExecutable(data)); }, item.Transaction->m_queries.front().query);
+            else
+                TransactionTask::Execute(conn, item.Transaction);
+        }
+    }
+
+    _batchCount.fetch_add(1, std::memory_order_relaxed);
+    _batchItemCount.fetch_add(batch.Items.size(), std::memory_order_relaxed);
+    _batchExecutionTime.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
+
+    // release queue size trackers only after execution
+    batch.Items.clear();
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::Execute(char const* sql)
 {
     if (!sql)
         return;
 
-    boost::asio::post(_ioContext->get_executor(), [this, sql = std::string(sql), tracker = QueueSizeTracker(this)]
+    if (_maxBatchStatements > 1)
+    {
+        SQLTransaction<T> transaction = BeginTransaction();
+        transaction->Append(sql);
+        EnqueueBatched(std::move(transaction), true);
+        return;
+    }
+
+    Post([this, sql = std::string(sql), tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
         BasicStatementTask::Execute(conn, sql.c_str());
@@ -554,7 +703,15 @@ void DatabaseWorkerPool<T>::Execute(char const* sql)
 template <class T>
 void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
 {
-    boost::asio::post(_ioContext->get_executor(), [this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this)]
+    if (_maxBatchStatements > 1)
+    {
+        SQLTransaction<T> transaction = BeginTransaction();
+        transaction->Append(stmt);
+        EnqueueBatched(std::move(transaction), true);
+        return;
+    }
+
+    Post([this, stmt = std::unique_ptr<PreparedStatement<T>>(stmt), tracker = QueueSizeTracker(this)]
     {
         T* conn = GetAsyncConnectionForCurrentThread();
         PreparedStatementTask::Execute(conn, stmt.get());
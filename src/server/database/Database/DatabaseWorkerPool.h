@@ -24,6 +24,8 @@
 #include "StringFormat.h"
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -48,6 +50,9 @@ class DatabaseWorkerPool
 
         void SetConnectionInfo(std::string const& infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+        //! Consecutive one-way statements and transactions are committed together until they hold this many queries, values below 2 disable batching
+        void SetMaxBatchStatements(uint32 maxBatchStatements) { _maxBatchStatements = maxBatchStatements; }
+
         uint32 Open();
 
         void Close();
@@ -60,6 +65,20 @@ class DatabaseWorkerPool
             return _connectionInfo.get();
         }
 
+        //! Number of connections shared by synchronous queries, threads querying beyond that wait for a free one
+        uint8 GetSynchConnectionCount() const
+        {
+            return uint8(_connections[IDX_SYNCH].size());
+        }
+
+        //! Opens additional synchronous connections until there are count of them, for a burst of parallel synchronous queries like startup loading.
+        //! Returns number of synchronous connections, which is lower than count if the server refused more.
+        //! Must not be called while other threads run synchronous queries on this pool.
+        uint8 ReserveSynchConnections(uint8 count);
+
+        //! Closes synchronous connections opened by ReserveSynchConnections, same threading rules apply.
+        void ReleaseSynchConnections();
+
         /**
             Delayed one-way statement methods.
         */
@@ -212,6 +231,16 @@ class DatabaseWorkerPool
 
         size_t QueueSize() const;
 
+        struct BatchStatistics
+        {
+            uint64 Batches = 0;
+            uint64 Items = 0;               //!< one-way statements and transactions executed by batches
+            std::chrono::microseconds ExecutionTime = {};
+        };
+
+        //! Returns statistics of batches executed since last call and resets them
+        BatchStatistics ConsumeBatchStatistics();
+
     private:
         uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
@@ -228,6 +257,15 @@ class DatabaseWorkerPool
         struct QueueSizeTracker;
         friend QueueSizeTracker;
 
+        struct StatementBatch;
+
+        //! Posts any task that is not part of a batch, statements queued after it must not join an earlier batch
+        template <typename Task>
+        auto Post(Task&& task);
+
+        void EnqueueBatched(SQLTransaction<T> transaction, bool standalone);
+        void ExecuteBatch(StatementBatch& batch);
+
         //! Queue shared by async worker threads.
         std::unique_ptr<Trinity::Asio::IoContext> _ioContext;
         std::atomic<size_t> _queueSize;
@@ -235,6 +273,13 @@ class DatabaseWorkerPool
         std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
         std::vector<uint8> _preparedStatementSize;
         uint8 _async_threads, _synch_threads;
+
+        std::mutex _batchLock;
+        std::shared_ptr<StatementBatch> _openBatch;
+        uint32 _maxBatchStatements;
+        std::atomic<uint64> _batchCount;
+        std::atomic<uint64> _batchItemCount;
+        std::atomic<uint64> _batchExecutionTime;
 };
 
 #endif
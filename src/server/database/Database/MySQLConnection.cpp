@@ -407,20 +407,32 @@ void MySQLConnection::CommitTransaction()
 
 int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transaction)
 {
-    std::vector<TransactionData> const& queries = transaction->m_queries;
-    if (queries.empty())
+    return ExecuteTransactions({ &transaction, 1 });
+}
+
+//- Executes queries of all transactions in a single transaction, used to commit queued statements together
+int MySQLConnection::ExecuteTransactions(std::span<std::shared_ptr<TransactionBase> const> transactions)
+{
+    std::size_t queryCount = 0;
+    for (std::shared_ptr<TransactionBase> const& transaction : transactions)
+        queryCount += transaction->m_queries.size();
+
+    if (!queryCount)
         return -1;
 
     BeginTransaction();
 
-    for (auto itr = queries.begin(); itr != queries.end(); ++itr)
+    for (std::shared_ptr<TransactionBase> const& transaction : transactions)
     {
-        if (!std::visit([this](auto&& data) { return this->Execute(TransactionData::ToExecutable(data)); }, itr->query))
+        for (auto itr = transaction->m_queries.begin(); itr != transaction->m_queries.end(); ++itr)
         {
-            TC_LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
-            int errorCode = GetLastError();
-            RollbackTransaction();
-            return errorCode;
+            if (!std::visit([this](auto&& data) { return this->Execute(TransactionData::ToExecutable(data)); }, itr->query))
+            {
+                TC_LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queryCount);
+                int errorCode = GetLastError();
+                RollbackTransaction();
+                return errorCode;
+            }
         }
     }
 
@@ -23,6 +23,7 @@
 #include "DatabaseEnvFwd.h"
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 #include <vector>
@@ -73,6 +74,7 @@ class TC_DATABASE_API MySQLConnection
         void RollbackTransaction();
         void CommitTransaction();
         int ExecuteTransaction(std::shared_ptr<TransactionBase> transaction);
+        int ExecuteTransactions(std::span<std::shared_ptr<TransactionBase> const> transactions);
         size_t EscapeString(char* to, const char* from, size_t length);
         void Ping();
 
@@ -18,6 +18,7 @@
 #include "DBUpdater.h"
 #include "BuiltInConfig.h"
 #include "Config.h"
+#include "CryptoHash.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "GitRevision.h"
@@ -25,6 +26,7 @@
 #include "QueryResult.h"
 #include "StartProcess.h"
 #include "UpdateFetcher.h"
+#include "Util.h"
 #include <boost/filesystem/operations.hpp>
 #include <fstream>
 #include <iostream>
@@ -339,6 +341,26 @@ bool DBUpdater<T>::Populate(DatabaseWorkerPool<T>& pool)
     return true;
 }
 
+template<class T>
+std::string DBUpdater<T>::GetAppliedUpdatesHash(DatabaseWorkerPool<T>& pool)
+{
+    Trinity::Crypto::SHA1 hash;
+    if (QueryResult const result = Retrieve(pool, "SELECT `name`, `hash` FROM `updates` ORDER BY `name` ASC"))
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            hash.UpdateData(fields[0].GetStringView());
+            hash.UpdateData("\n");
+            hash.UpdateData(fields[1].GetStringView());
+            hash.UpdateData("\n");
+        } while (result->NextRow());
+    }
+
+    hash.Finalize();
+    return ByteArrayToHexStr(hash.GetDigest());
+}
+
 template<class T>
 QueryResult DBUpdater<T>::Retrieve(DatabaseWorkerPool<T>& pool, std::string const& query)
 {
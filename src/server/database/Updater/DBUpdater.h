@@ -79,6 +79,9 @@ public:
 
     static bool Populate(DatabaseWorkerPool<T>& pool);
 
+    // Hash of all updates applied to the database, changes whenever an update is applied, reapplied or removed
+    static std::string GetAppliedUpdatesHash(DatabaseWorkerPool<T>& pool);
+
 private:
     static QueryResult Retrieve(DatabaseWorkerPool<T>& pool, std::string const& query);
     static void Apply(DatabaseWorkerPool<T>& pool, std::string const& query);
@@ -250,17 +250,13 @@ void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint3
     {
         TC_LOG_WARN("scripts.ai", "SmartScript::ProcessEventsFor: reached the limit of max allowed nested ProcessEventsFor() calls with event {}, skipping!\n{}", e, GetBaseObject()->GetDebugInfo());
     }
-    else
+    else if (e != SMART_EVENT_LINK) // special handling, linked events are only processed by the event linking to them
     {
-        for (SmartScriptHolder& event : mEvents)
+        for (uint32 position : mEventIndex.GetPositions(e))
         {
-            SMART_EVENT eventType = SMART_EVENT(event.GetEventType());
-            if (eventType == SMART_EVENT_LINK)//special handling
-                continue;
-
-            if (eventType == e)
-                if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
-                    ProcessEvent(event, unit, var0, var1, bvar, spell, gob, varString);
+            SmartScriptHolder& event = mEvents[position];
+            if (IsMeetingEventConditions(event, unit))
+                ProcessEvent(event, unit, var0, var1, bvar, spell, gob, varString);
         }
     }
 
@@ -2662,7 +2658,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 void SmartScript::ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, uint32 const& max, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob, std::string const& varString)
 {
     // We may want to execute action rarely and because of this if condition is not fulfilled the action will be rechecked in a long time
-    if (sConditionMgr->IsObjectMeetingSmartEventConditions(e.entryOrGuid, e.event_id, e.source_type, unit, GetBaseObject()))
+    if (IsMeetingEventConditions(e, unit))
     {
         RecalcTimer(e, min, max);
         ProcessAction(e, unit, var0, var1, bvar, spell, gob, varString);
@@ -3816,6 +3812,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(installevent);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        mEventIndex.Build(mEvents);
     }
 }
 
@@ -3919,6 +3916,7 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        mEventIndex.Build(mEvents);
         mEventSortingRequired = false;
     }
 
@@ -3984,6 +3982,19 @@ void SmartScript::SortEvents(SmartAIEventList& events)
     std::sort(events.begin(), events.end());
 }
 
+bool SmartScript::IsMeetingEventConditions(SmartScriptHolder& e, Unit const* unit) const
+{
+    uint32 conditionsGeneration = sConditionMgr->GetLoadGeneration();
+    if (e.conditionsGeneration != conditionsGeneration)
+    {
+        e.conditions = sConditionMgr->GetConditionsForSmartEvent(e.entryOrGuid, e.event_id, e.source_type);
+        e.conditionsGeneration = conditionsGeneration;
+    }
+
+    ConditionSourceInfo sourceInfo(unit, GetBaseObject());
+    return e.conditions.Meets(sourceInfo);
+}
+
 void SmartScript::RaisePriority(SmartScriptHolder& e)
 {
     e.timer = 1;
@@ -4093,6 +4104,8 @@ void SmartScript::GetScript()
         default:
             break;
     }
+
+    mEventIndex.Build(mEvents);
 }
 
 void SmartScript::OnInitialize(WorldObject* obj, AreaTriggerEntry const* at, SceneTemplate const* scene, Quest const* qst, uint32 evnt)
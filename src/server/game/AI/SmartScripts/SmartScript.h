@@ -117,7 +117,10 @@ class TC_GAME_API SmartScript
         void RaisePriority(SmartScriptHolder& e);
         void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
+        bool IsMeetingEventConditions(SmartScriptHolder& e, Unit const* unit) const;
+
         SmartAIEventList mEvents;
+        SmartEventIndex mEventIndex;
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         ObjectGuid mTimedActionListInvoker;
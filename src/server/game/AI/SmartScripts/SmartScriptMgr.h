@@ -18,15 +18,19 @@
 #ifndef TRINITY_SMARTSCRIPTMGR_H
 #define TRINITY_SMARTSCRIPTMGR_H
 
+#include "ConditionMgr.h"
 #include "DBCEnums.h"
 #include "Define.h"
 #include "ObjectGuid.h"
 #include "WaypointDefines.h"
 #include "advstd.h"
+#include <array>
 #include <limits>
 #include <map>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class WorldObject;
 enum SpellEffIndex : uint8;
@@ -1651,6 +1655,10 @@ struct SmartScriptHolder
     bool runOnce;
     bool enableTimed;
 
+    // cached lookup of conditions for this event, valid for ConditionMgr load generation conditionsGeneration
+    ConditionsReference conditions;
+    uint32 conditionsGeneration = 0;
+
     operator bool() const { return entryOrGuid != 0; }
     // Default comparision operator using priority field as first ordering field
     std::strong_ordering operator<=>(SmartScriptHolder const& right) const
@@ -1701,6 +1709,43 @@ typedef std::unordered_map<uint32, ObjectGuidVector> ObjectVectorMap;
 typedef std::vector<SmartScriptHolder> SmartAIEventList;
 typedef std::vector<SmartScriptHolder> SmartAIEventStoredList;
 
+// positions of events in a SmartAIEventList grouped by event type, in list order within each type
+// must be rebuilt after the list is modified or reordered
+class SmartEventIndex
+{
+public:
+    void Build(SmartAIEventList const& events)
+    {
+        _offsets.fill(0);
+        for (SmartScriptHolder const& e : events)
+            if (e.GetEventType() < SMART_EVENT_END)
+                ++_offsets[e.GetEventType() + 1];
+
+        for (std::size_t i = 1; i < _offsets.size(); ++i)
+            _offsets[i] += _offsets[i - 1];
+
+        std::array<uint32, SMART_EVENT_END> next;
+        std::copy_n(_offsets.begin(), SMART_EVENT_END, next.begin());
+
+        _positions.resize(_offsets[SMART_EVENT_END]);
+        for (uint32 i = 0; i < events.size(); ++i)
+            if (events[i].GetEventType() < SMART_EVENT_END)
+                _positions[next[events[i].GetEventType()]++] = i;
+    }
+
+    std::span<uint32 const> GetPositions(SMART_EVENT type) const
+    {
+        if (type >= SMART_EVENT_END)
+            return {};
+
+        return { _positions.data() + _offsets[type], _positions.data() + _offsets[type + 1] };
+    }
+
+private:
+    std::array<uint32, SMART_EVENT_END + 1> _offsets = { };
+    std::vector<uint32> _positions;
+};
+
 // all events for all entries / guids
 typedef std::unordered_map<int64, SmartAIEventList> SmartAIEventMap;
 
@@ -118,6 +118,26 @@ bool AchievementMgr::CanUpdateCriteriaTree(Criteria const* criteria, CriteriaTre
     return CriteriaHandler::CanUpdateCriteriaTree(criteria, tree, referencePlayer);
 }
 
+// criteria only used by completed achievements can never be updated again
+void AchievementMgr::UpdateExhaustedCriteria(AchievementEntry const* achievement)
+{
+    CriteriaTree const* tree = sCriteriaMgr->GetCriteriaTree(achievement->CriteriaTree);
+    if (!tree)
+        return;
+
+    CriteriaMgr::WalkCriteriaTree(tree, [this](CriteriaTree const* node)
+    {
+        if (!node->Criteria || IsCriteriaExhausted(node->Criteria))
+            return;
+
+        for (CriteriaTree const* criteriaTree : *node->Criteria->Trees)
+            if (criteriaTree->Achievement && !HasAchieved(criteriaTree->Achievement->ID))
+                return;
+
+        SetCriteriaExhausted(node->Criteria);
+    });
+}
+
 bool AchievementMgr::CanCompleteCriteriaTree(CriteriaTree const* tree)
 {
     AchievementEntry const* achievement = tree->Achievement;
@@ -260,6 +280,7 @@ void PlayerAchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, Pre
 
             CompletedAchievementData& ca = _completedAchievements[achievementid];
             ca.Date = fields[1].GetInt64();
+            UpdateExhaustedCriteria(achievement);
             ca.Changed = false;
 
             _achievementPoints += achievement->Points;
@@ -485,6 +506,7 @@ void PlayerAchievementMgr::CompletedAchievement(AchievementEntry const* achievem
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.Date = GameTime::GetGameTime();
     ca.Changed = true;
+    UpdateExhaustedCriteria(achievement);
 
     if (achievement->Flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
         sAchievementMgr->SetRealmCompleted(achievement);
@@ -746,6 +768,7 @@ void GuildAchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, Prep
 
             CompletedAchievementData& ca = _completedAchievements[achievementid];
             ca.Date = fields[1].GetInt64();
+            UpdateExhaustedCriteria(achievement);
             for (std::string_view guid : Trinity::Tokenize(fields[2].GetStringView(), ',', false))
                 if (Optional<ObjectGuid::LowType> parsedGuid = Trinity::StringTo<ObjectGuid::LowType>(guid))
                     ca.CompletingPlayers.insert(ObjectGuid::Create<HighGuid::Player>(*parsedGuid));
@@ -951,6 +974,7 @@ void GuildAchievementMgr::CompletedAchievement(AchievementEntry const* achieveme
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.Date = GameTime::GetGameTime();
     ca.Changed = true;
+    UpdateExhaustedCriteria(achievement);
 
     if (achievement->Flags & ACHIEVEMENT_FLAG_SHOW_GUILD_MEMBERS)
     {
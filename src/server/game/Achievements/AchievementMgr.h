@@ -66,6 +66,7 @@ protected:
     void AfterCriteriaTreeUpdate(CriteriaTree const* tree, Player* referencePlayer) override;
 
     bool IsCompletedAchievement(AchievementEntry const* entry);
+    void UpdateExhaustedCriteria(AchievementEntry const* achievement);
 
     bool RequiredAchievementSatisfied(uint32 achievementId) const override;
 
@@ -456,6 +456,7 @@ void CriteriaHandler::Reset()
         SendCriteriaProgressRemoved(criteriaprogress.first);
 
     _criteriaProgress.clear();
+    _exhaustedCriteria.clear();
 }
 
 /**
@@ -489,18 +490,18 @@ void CriteriaHandler::UpdateCriteria(CriteriaType type, uint64 miscValue1 /*= 0*
 
     CriteriaList const& criteriaList = GetCriteriaByType(type, uint32(miscValue1));
     for (Criteria const* criteria : criteriaList)
-        UpdateCriteria(criteria, miscValue1, miscValue2, miscValue3, ref, referencePlayer);
+        if (!IsCriteriaExhausted(criteria))
+            UpdateCriteria(criteria, miscValue1, miscValue2, miscValue3, ref, referencePlayer);
 }
 
 void CriteriaHandler::UpdateCriteria(Criteria const* criteria, uint64 miscValue1, uint64 miscValue2, uint64 miscValue3, WorldObject const* ref, Player* referencePlayer)
 {
-    CriteriaTreeList const* trees = sCriteriaMgr->GetCriteriaTreesByCriteria(criteria->ID);
-    if (!CanUpdateCriteria(criteria, trees, miscValue1, miscValue2, miscValue3, ref, referencePlayer))
+    if (!CanUpdateCriteria(criteria, criteria->Trees, miscValue1, miscValue2, miscValue3, ref, referencePlayer))
         return;
 
     // requirements not found in the dbc
-    if (CriteriaDataSet const* data = sCriteriaMgr->GetCriteriaDataSet(criteria))
-        if (!data->Meets(referencePlayer, ref, uint32(miscValue1), uint32(miscValue2)))
+    if (criteria->Data)
+        if (!criteria->Data->Meets(referencePlayer, ref, uint32(miscValue1), uint32(miscValue2)))
             return;
 
     switch (CriteriaType(criteria->Entry->Type))
@@ -864,7 +865,7 @@ void CriteriaHandler::UpdateCriteria(Criteria const* criteria, uint64 miscValue1
             break;                          // Not implemented yet :(
     }
 
-    for (CriteriaTree const* tree : *trees)
+    for (CriteriaTree const* tree : *criteria->Trees)
     {
         if (IsCompletedCriteriaTree(tree))
             CompletedCriteriaTree(tree, referencePlayer);
@@ -1355,6 +1356,14 @@ bool CriteriaHandler::CanUpdateCriteria(Criteria const* criteria, CriteriaTreeLi
     return true;
 }
 
+void CriteriaHandler::SetCriteriaExhausted(Criteria const* criteria)
+{
+    if (_exhaustedCriteria.empty())
+        _exhaustedCriteria.resize(sCriteriaMgr->GetCriteriaCount());
+
+    _exhaustedCriteria[criteria->Index] = true;
+}
+
 bool CriteriaHandler::ConditionsSatisfied(Criteria const* criteria, Player* /*referencePlayer*/) const
 {
     if (criteria->Entry->StartEvent && !_startedCriteria.contains(criteria->ID))
@@ -1500,8 +1509,8 @@ bool CriteriaHandler::RequirementsSatisfied(Criteria const* criteria, uint64 mis
                     return false;
             }
 
-            if (CriteriaDataSet const* data = sCriteriaMgr->GetCriteriaDataSet(criteria))
-                if (!data->Meets(referencePlayer, ref))
+            if (criteria->Data)
+                if (!criteria->Data->Meets(referencePlayer, ref))
                     return false;
             break;
         }
@@ -4799,8 +4808,10 @@ void CriteriaMgr::LoadCriteriaList()
 
         Criteria* criteria = new Criteria();
         criteria->ID = criteriaEntry->ID;
+        criteria->Index = uint32(_criteria.size());
         criteria->Entry = criteriaEntry;
         criteria->Modifier = Trinity::Containers::MapGetValuePtr(_criteriaModifiers, criteriaEntry->ModifierTreeId);
+        criteria->Trees = &treeItr->second;
 
         _criteria[criteria->ID] = criteria;
 
@@ -4892,6 +4903,8 @@ void CriteriaMgr::LoadCriteriaData()
     uint32 oldMSTime = getMSTime();
 
     _criteriaDataMap.clear();                              // need for reload case
+    for (auto const& [criteriaId, criteria] : _criteria)
+        criteria->Data = nullptr;
 
     QueryResult result = WorldDatabase.Query("SELECT criteria_id, type, value1, value2, ScriptName FROM criteria_data");
 
@@ -4945,6 +4958,9 @@ void CriteriaMgr::LoadCriteriaData()
     }
     while (result->NextRow());
 
+    for (auto& [criteriaId, dataSet] : _criteriaDataMap)
+        _criteria[criteriaId]->Data = &dataSet;
+
     TC_LOG_INFO("server.loading", ">> Loaded {} additional criteria data in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -31,7 +31,9 @@ class Player;
 class WorldObject;
 class WorldPacket;
 struct AchievementEntry;
+struct CriteriaDataSet;
 struct CriteriaEntry;
+struct CriteriaTree;
 struct CriteriaTreeEntry;
 struct ModifierTreeEntry;
 struct QuestObjective;
@@ -55,8 +57,11 @@ enum CriteriaFlagsCu
 struct Criteria
 {
     uint32 ID = 0;
+    uint32 Index = 0;                                       // sequential index for per handler bit sets, see CriteriaMgr::GetCriteriaCount
     CriteriaEntry const* Entry = nullptr;
     ModifierTreeNode const* Modifier = nullptr;
+    std::vector<CriteriaTree const*> const* Trees = nullptr;
+    CriteriaDataSet const* Data = nullptr;                  // requirements from `criteria_data`, null if none
     uint32 FlagsCu = 0;
 };
 
@@ -311,8 +316,14 @@ protected:
     virtual std::string GetOwnerInfo() const = 0;
     virtual CriteriaList const& GetCriteriaByType(CriteriaType type, uint32 asset) const = 0;
 
+    bool IsCriteriaExhausted(Criteria const* criteria) const { return criteria->Index < _exhaustedCriteria.size() && _exhaustedCriteria[criteria->Index]; }
+    void SetCriteriaExhausted(Criteria const* criteria);
+
     CriteriaProgressMap _criteriaProgress;
     std::unordered_map<uint32 /*criteriaID*/, Milliseconds /*time left*/> _startedCriteria;
+
+    // criteria none of whose trees can be updated by this handler anymore, skipped without evaluating, indexed by Criteria::Index
+    std::vector<bool> _exhaustedCriteria;
 };
 
 class TC_GAME_API CriteriaMgr
@@ -395,6 +406,7 @@ public:
     void LoadCriteriaData();
     CriteriaTree const* GetCriteriaTree(uint32 criteriaTreeId) const;
     Criteria const* GetCriteria(uint32 criteriaId) const;
+    uint32 GetCriteriaCount() const { return uint32(_criteria.size()); }
     ModifierTreeNode const* GetModifierTree(uint32 modifierTreeId) const;
 
     static std::span<CriteriaType const> GetRetroactivelyUpdateableCriteriaTypes();
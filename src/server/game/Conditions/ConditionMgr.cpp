@@ -1219,6 +1219,15 @@ bool ConditionMgr::IsObjectMeetingSmartEventConditions(int64 entryOrGuid, uint32
     return true;
 }
 
+ConditionsReference ConditionMgr::GetConditionsForSmartEvent(int64 entryOrGuid, uint32 eventId, uint32 sourceType) const
+{
+    auto itr = ConditionStore[CONDITION_SOURCE_TYPE_SMART_EVENT].find({ eventId + 1, int32(entryOrGuid), sourceType });
+    if (itr != ConditionStore[CONDITION_SOURCE_TYPE_SMART_EVENT].end())
+        return { itr->second };
+
+    return { };
+}
+
 bool ConditionMgr::IsObjectMeetingVendorItemConditions(uint32 creatureId, uint32 itemId, Player const* player, Creature const* vendor) const
 {
     auto itr = ConditionStore[CONDITION_SOURCE_TYPE_NPC_VENDOR].find({ creatureId, int32(itemId), 0 });
@@ -1289,6 +1298,8 @@ void ConditionMgr::LoadConditions(bool isReload)
 
     Clean();
 
+    ++LoadGeneration;
+
     //must clear all custom handled cases (groupped types) before reload
     if (isReload)
     {
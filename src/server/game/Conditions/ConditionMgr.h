@@ -295,6 +295,8 @@ typedef std::vector<Condition> ConditionContainer;
 typedef std::unordered_map<ConditionId, std::shared_ptr<ConditionContainer>> ConditionsByEntryMap; // stored as shared_ptr to give out weak_ptrs to hold by other code (ownership not shared)
 typedef std::array<ConditionsByEntryMap, CONDITION_SOURCE_TYPE_MAX> ConditionEntriesByTypeArray;
 
+struct ConditionsReference;
+
 class TC_GAME_API ConditionMgr
 {
     private:
@@ -327,11 +329,15 @@ class TC_GAME_API ConditionMgr
         bool HasConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const;
         bool IsObjectMeetingVehicleSpellConditions(uint32 creatureId, uint32 spellId, Player const* player, Unit const* vehicle) const;
         bool IsObjectMeetingSmartEventConditions(int64 entryOrGuid, uint32 eventId, uint32 sourceType, Unit const* unit, WorldObject const* baseObject) const;
+        ConditionsReference GetConditionsForSmartEvent(int64 entryOrGuid, uint32 eventId, uint32 sourceType) const;
         bool IsObjectMeetingVendorItemConditions(uint32 creatureId, uint32 itemId, Player const* player, Creature const* vendor) const;
         bool IsObjectMeetingPlayerChoiceResponseConditions(uint32 playerChoiceId, int32 playerChoiceResponseId, Player const* player) const;
 
         bool IsSpellUsedInSpellClickConditions(uint32 spellId) const;
 
+        // Changes every time conditions are loaded, lets holders of ConditionsReference notice conditions added by reloads
+        uint32 GetLoadGeneration() const { return LoadGeneration; }
+
         ConditionContainer const* GetConditionsForAreaTrigger(uint32 areaTriggerId, bool isServerSide) const;
         bool IsObjectMeetingTrainerSpellConditions(uint32 trainerId, uint32 spellId, Player* player) const;
         bool IsObjectMeetingVisibilityByObjectIdConditions(WorldObject const* obj, WorldObject const* seer) const;
@@ -371,6 +377,8 @@ class TC_GAME_API ConditionMgr
         ConditionEntriesByTypeArray     ConditionStore;
 
         std::unordered_set<uint32> SpellsUsedInSpellClickConditions;
+
+        uint32 LoadGeneration = 1;
 };
 
 #define sConditionMgr ConditionMgr::instance()
@@ -26,6 +26,7 @@
 #include "MapUtils.h"
 #include "Random.h"
 #include "Regex.h"
+#include "ThreadPool.h"
 #include "Timer.h"
 #include "Util.h"
 #include "World.h"
@@ -35,6 +36,7 @@
 #include <boost/filesystem/directory.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <numeric>
+#include <semaphore>
 #include <cctype>
 #include <cmath>
 
@@ -544,8 +546,41 @@ namespace
     std::unordered_map<uint32, std::unordered_set<uint32>> _pvpStatIdsByMap;
 }
 
-void LoadDB2(std::bitset<TOTAL_LOCALES>& availableDb2Locales, std::vector<std::string>& errlist, StorageMap& stores, DB2StorageBase* storage, std::string const& db2Path,
-    LocaleConstant defaultLocale, std::size_t cppRecordSize)
+struct DB2LoadTask
+{
+    DB2StorageBase* Storage;
+    std::size_t CppRecordSize;
+    std::vector<std::string> Errors;
+    uint32 LoadTime = 0;
+    bool Loaded = false;
+};
+
+/// Lets at most HotfixDatabase.SynchThreads loader threads query the hotfix database at once
+/// others wait here instead of spinning in DatabaseWorkerPool::GetFreeConnection
+class HotfixDatabaseSlot
+{
+public:
+    explicit HotfixDatabaseSlot(std::counting_semaphore<>* slots) : _slots(slots)
+    {
+        if (_slots)
+            _slots->acquire();
+    }
+
+    HotfixDatabaseSlot(HotfixDatabaseSlot const&) = delete;
+    HotfixDatabaseSlot& operator=(HotfixDatabaseSlot const&) = delete;
+
+    ~HotfixDatabaseSlot()
+    {
+        if (_slots)
+            _slots->release();
+    }
+
+private:
+    std::counting_semaphore<>* _slots;
+};
+
+bool LoadDB2(std::bitset<TOTAL_LOCALES> const& availableDb2Locales, std::vector<std::string>& errlist, DB2StorageBase* storage, std::string const& db2Path,
+    LocaleConstant defaultLocale, std::size_t cppRecordSize, std::counting_semaphore<>* hotfixDatabaseSlots = nullptr)
 {
     // validate structure
     {
@@ -594,11 +629,14 @@ void LoadDB2(std::bitset<TOTAL_LOCALES>& availableDb2Locales, std::vector<std::s
     catch (std::exception const& e)
     {
         errlist.emplace_back(e.what());
-        return;
+        return false;
     }
 
     // load additional data and enUS strings from db
-    storage->LoadFromDB();
+    {
+        HotfixDatabaseSlot slot(hotfixDatabaseSlots);
+        storage->LoadFromDB();
+    }
 
     for (LocaleConstant i = LOCALE_enUS; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
     {
@@ -622,11 +660,14 @@ void LoadDB2(std::bitset<TOTAL_LOCALES>& availableDb2Locales, std::vector<std::s
         }
     }
 
-    for (LocaleConstant i = LOCALE_koKR; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
-        if (availableDb2Locales[i])
-            storage->LoadStringsFromDB(i);
+    {
+        HotfixDatabaseSlot slot(hotfixDatabaseSlots);
+        for (LocaleConstant i = LOCALE_koKR; i < TOTAL_LOCALES; i = LocaleConstant(i + 1))
+            if (availableDb2Locales[i])
+                storage->LoadStringsFromDB(i);
+    }
 
-    stores[storage->GetTableHash()] = storage;
+    return true;
 }
 
 DB2Manager& DB2Manager::Instance()
@@ -660,9 +701,10 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
     if (!availableDb2Locales[defaultLocale])
         return 0;
 
+    std::vector<DB2LoadTask> loadTasks;
     auto LOAD_DB2 = [&]<typename T>(DB2Storage<T>& store)
     {
-        LoadDB2(availableDb2Locales, loadErrors, _stores, &store, db2Path, defaultLocale, sizeof(T));
+        loadTasks.push_back({ .Storage = &store, .CppRecordSize = sizeof(T) });
     };
 
     LOAD_DB2(sAchievementStore);
@@ -1022,6 +1064,55 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
     LOAD_DB2(sWorldMapOverlayStore);
     LOAD_DB2(sWorldStateExpressionStore);
 
+    uint32 loadThreads = sWorld->getIntConfig(CONFIG_STARTUP_LOAD_THREADS);
+    if (!loadThreads)
+        loadThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    // stores do not depend on each other until indexed in IndexLoadedStores, files can be parsed in parallel
+    // hotfix database overlays only overlap up to the number of synchronous hotfix database connections
+    std::counting_semaphore<> hotfixDatabaseSlots(std::max<uint8>(HotfixDatabase.GetSynchConnectionCount(), 1));
+    auto loadStore = [&](DB2LoadTask& task)
+    {
+        uint32 storeMSTime = getMSTime();
+        try
+        {
+            task.Loaded = LoadDB2(availableDb2Locales, task.Errors, task.Storage, db2Path, defaultLocale, task.CppRecordSize,
+                loadThreads > 1 ? &hotfixDatabaseSlots : nullptr);
+        }
+        catch (std::exception const& e)
+        {
+            task.Errors.emplace_back(Trinity::StringFormat("{}: {}", task.Storage->GetFileName(), e.what()));
+        }
+        task.LoadTime = GetMSTimeDiffToNow(storeMSTime);
+    };
+
+    if (loadThreads > 1)
+    {
+        Trinity::ThreadPool pool(loadThreads);
+        for (DB2LoadTask& task : loadTasks)
+            pool.PostWork([&loadStore, &task]() { loadStore(task); });
+
+        pool.Join();
+    }
+    else
+        for (DB2LoadTask& task : loadTasks)
+            loadStore(task);
+
+    for (DB2LoadTask& task : loadTasks)
+    {
+        if (task.Loaded)
+            _stores[task.Storage->GetTableHash()] = task.Storage;
+
+        std::move(task.Errors.begin(), task.Errors.end(), std::back_inserter(loadErrors));
+    }
+
+    if (sLog->ShouldLog("server.loading", LOG_LEVEL_DEBUG))
+    {
+        std::ranges::sort(loadTasks, std::ranges::greater(), &DB2LoadTask::LoadTime);
+        for (DB2LoadTask const& task : loadTasks)
+            TC_LOG_DEBUG("server.loading", "Loaded {} in {} ms", task.Storage->GetFileName(), task.LoadTime);
+    }
+
     // error checks
     if (!loadErrors.empty())
     {
@@ -1047,7 +1138,7 @@ uint32 DB2Manager::LoadStores(std::string const& dataPath, LocaleConstant defaul
         return 0;
     }
 
-    TC_LOG_INFO("server.loading", ">> Initialized {} DB2 data stores in {} ms", _stores.size(), GetMSTimeDiffToNow(oldMSTime));
+    TC_LOG_INFO("server.loading", ">> Initialized {} DB2 data stores in {} ms using {} threads", _stores.size(), GetMSTimeDiffToNow(oldMSTime), loadThreads);
 
     return availableDb2Locales.to_ulong();
 }
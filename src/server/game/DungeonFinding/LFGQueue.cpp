@@ -19,6 +19,7 @@
 #include "Containers.h"
 #include "GameTime.h"
 #include "Group.h"
+#include "Hash.h"
 #include "LFGMgr.h"
 #include "Log.h"
 #include <sstream>
@@ -26,30 +27,6 @@
 namespace lfg
 {
 
-/**
-   Given a list of guids returns the concatenation using | as delimiter
-
-   @param[in]     check list of guids
-   @returns Concatenated string
-*/
-std::string ConcatenateGuids(GuidList const& check)
-{
-    if (check.empty())
-        return "";
-
-    // need the guids in order to avoid duplicates
-    GuidSet guids(check.begin(), check.end());
-
-    std::ostringstream o;
-
-    GuidSet::const_iterator it = guids.begin();
-    o << it->ToHexString();
-    for (++it; it != guids.end(); ++it)
-        o << '|' << it->ToHexString();
-
-    return o.str();
-}
-
 char const* GetCompatibleString(LfgCompatibility compatibles)
 {
     switch (compatibles)
@@ -79,11 +56,45 @@ char const* GetCompatibleString(LfgCompatibility compatibles)
     }
 }
 
-LfgQueueData::LfgQueueData() : joinTime(GameTime::GetGameTime()), tanks(LFG_TANKS_NEEDED),
-healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED)
+void LfgCompatibilityKey::Add(uint32 slot)
+{
+    if (count >= MaxSlots)
+        return;
+
+    auto end = slots.begin() + count;
+    auto itr = std::upper_bound(slots.begin(), end, slot);
+    std::move_backward(itr, end, end + 1);
+    *itr = slot;
+    ++count;
+}
+
+bool LfgCompatibilityKey::Contains(uint32 slot) const
+{
+    return std::binary_search(slots.begin(), slots.begin() + count, slot);
+}
+
+std::size_t LfgCompatibilityKeyHash::operator()(LfgCompatibilityKey const& key) const
+{
+    std::size_t hashVal = 0;
+    for (uint8 i = 0; i < key.count; ++i)
+        Trinity::hash_combine(hashVal, key.slots[i]);
+
+    return hashVal;
+}
+
+LfgQueueData::LfgQueueData() : slot(0), joinTime(GameTime::GetGameTime()), tanks(LFG_TANKS_NEEDED),
+healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED), dungeonMask(0)
 { }
 
-LFGQueue::LFGQueue() = default;
+LfgQueueData::LfgQueueData(uint32 _slot, time_t _joinTime, LfgDungeonSet const& _dungeons, LfgRolesMap const& _roles) :
+    slot(_slot), joinTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED),
+    dungeons(_dungeons), dungeonMask(0), roles(_roles)
+{
+    for (uint32 dungeonId : dungeons)
+        dungeonMask |= UI64LIT(1) << (dungeonId % 64);
+}
+
+LFGQueue::LFGQueue() : NextQueueSlot(1) { }
 LFGQueue::LFGQueue(LFGQueue&& other) noexcept = default;
 LFGQueue& LFGQueue::operator=(LFGQueue&& right) noexcept = default;
 LFGQueue::~LFGQueue() = default;
@@ -144,25 +155,23 @@ void LFGQueue::RemoveFromQueue(ObjectGuid guid)
 {
     RemoveFromNewQueue(guid);
     RemoveFromCurrentQueue(guid);
-    RemoveFromCompatibles(guid);
 
-    std::string sguid = guid.ToHexString();
+    LfgQueueDataContainer::iterator itDelete = QueueDataStore.find(guid);
+    if (itDelete == QueueDataStore.end())
+        return;
+
+    uint32 slot = itDelete->second.slot;
+    QueueDataStore.erase(itDelete);
+    RemoveFromCompatibles(slot);
 
-    LfgQueueDataContainer::iterator itDelete = QueueDataStore.end();
     for (LfgQueueDataContainer::iterator itr = QueueDataStore.begin(); itr != QueueDataStore.end(); ++itr)
-        if (itr->first != guid)
+    {
+        if (itr->second.bestCompatible.Contains(slot))
         {
-            if (std::string::npos != itr->second.bestCompatible.find(sguid))
-            {
-                itr->second.bestCompatible.clear();
-                FindBestCompatibleInQueue(itr);
-            }
+            itr->second.bestCompatible = { };
+            FindBestCompatibleInQueue(itr);
         }
-        else
-            itDelete = itr;
-
-    if (itDelete != QueueDataStore.end())
-        QueueDataStore.erase(itDelete);
+    }
 }
 
 void LFGQueue::AddToNewQueue(ObjectGuid guid)
@@ -192,7 +201,11 @@ void LFGQueue::RemoveFromCurrentQueue(ObjectGuid guid)
 
 void LFGQueue::AddQueueData(ObjectGuid guid, time_t joinTime, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
 {
-    QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+    LfgQueueData& queueData = QueueDataStore[guid];
+    if (queueData.slot)
+        RemoveFromCompatibles(queueData.slot);
+
+    queueData = LfgQueueData(NextQueueSlot++, joinTime, dungeons, rolesMap);
     AddToQueue(guid);
 }
 
@@ -232,47 +245,87 @@ void LFGQueue::UpdateWaitTimeDps(int32 waitTime, uint32 dungeonId)
 }
 
 /**
-   Remove from cached compatible dungeons any entry that contains the given guid
+   Given a list of guids returns the key of their queue slots
 
-   @param[in]     guid Guid to remove from compatible cache
+   @param[in]     check list of guids
+   @returns Compatibility key, empty if check has too many guids or any of them is not queued
 */
-void LFGQueue::RemoveFromCompatibles(ObjectGuid guid)
+LfgCompatibilityKey LFGQueue::MakeCompatibilityKey(GuidList const& check) const
 {
-    std::string strGuid = guid.ToHexString();
+    LfgCompatibilityKey key;
+    if (check.size() > LfgCompatibilityKey::MaxSlots)
+        return key;
+
+    // not queued guids have no slot, nothing is cached for them (they are removed from queue when checked)
+    for (ObjectGuid const& guid : check)
+    {
+        LfgQueueDataContainer::const_iterator itQueue = QueueDataStore.find(guid);
+        if (itQueue == QueueDataStore.end())
+            return { };
+
+        key.Add(itQueue->second.slot);
+    }
+
+    return key;
+}
 
-    TC_LOG_DEBUG("lfg.queue.data.compatibles.remove", "Removing {}", guid.ToString());
-    for (LfgCompatibleContainer::iterator itNext = CompatibleMapStore.begin(); itNext != CompatibleMapStore.end();)
+std::string LFGQueue::GetCompatibilityKeyString(LfgCompatibilityKey const& key) const
+{
+    std::ostringstream o;
+    for (auto const& [guid, queueData] : QueueDataStore)
     {
-        LfgCompatibleContainer::iterator it = itNext++;
-        if (std::string::npos != it->first.find(strGuid))
-            CompatibleMapStore.erase(it);
+        if (!key.Contains(queueData.slot))
+            continue;
+
+        if (o.tellp())
+            o << '|';
+        o << guid.ToHexString();
     }
+
+    return o.str();
+}
+
+/**
+   Remove from cached compatible dungeons any entry that contains the given queue slot
+
+   @param[in]     slot Queue slot to remove from compatible cache
+*/
+void LFGQueue::RemoveFromCompatibles(uint32 slot)
+{
+    TC_LOG_DEBUG("lfg.queue.data.compatibles.remove", "Removing slot {}", slot);
+    std::erase_if(CompatibleMapStore, [slot](LfgCompatibleContainer::value_type const& compatible) { return compatible.first.Contains(slot); });
 }
 
 /**
    Stores the compatibility of a list of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     key Queue slots of the guids
    @param[in]     compatibles type of compatibility
 */
-void LFGQueue::SetCompatibles(std::string const& key, LfgCompatibility compatibles)
+void LFGQueue::SetCompatibles(LfgCompatibilityKey const& key, LfgCompatibility compatibles)
 {
+    if (key.IsEmpty())
+        return;
+
     LfgCompatibilityData& data = CompatibleMapStore[key];
     data.compatibility = compatibles;
 }
 
-void LFGQueue::SetCompatibilityData(std::string const& key, LfgCompatibilityData const& data)
+void LFGQueue::SetCompatibilityData(LfgCompatibilityKey const& key, LfgCompatibilityData const& data)
 {
+    if (key.IsEmpty())
+        return;
+
     CompatibleMapStore[key] = data;
 }
 
 /**
    Get the compatibility of a group of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     key Queue slots of the guids
    @return LfgCompatibility type of compatibility
 */
-LfgCompatibility LFGQueue::GetCompatibles(std::string const& key)
+LfgCompatibility LFGQueue::GetCompatibles(LfgCompatibilityKey const& key)
 {
     LfgCompatibleContainer::iterator itr = CompatibleMapStore.find(key);
     if (itr != CompatibleMapStore.end())
@@ -281,7 +334,7 @@ LfgCompatibility LFGQueue::GetCompatibles(std::string const& key)
     return LFG_COMPATIBILITY_PENDING;
 }
 
-LfgCompatibilityData* LFGQueue::GetCompatibilityData(std::string const& key)
+LfgCompatibilityData* LFGQueue::GetCompatibilityData(LfgCompatibilityKey const& key)
 {
     LfgCompatibleContainer::iterator itr = CompatibleMapStore.find(key);
     if (itr != CompatibleMapStore.end())
@@ -324,8 +377,8 @@ uint8 LFGQueue::FindGroups()
 */
 LfgCompatibility LFGQueue::FindNewGroups(GuidList& check, GuidList& all)
 {
-    std::string strGuids = ConcatenateGuids(check);
-    LfgCompatibility compatibles = GetCompatibles(strGuids);
+    LfgCompatibilityKey key = MakeCompatibilityKey(check);
+    LfgCompatibility compatibles = GetCompatibles(key);
 
     TC_LOG_DEBUG("lfg.queue.match.check", "Guids: ({}): {} - all({})", GetDetailedMatchRoles(check), GetCompatibleString(compatibles), GetDetailedMatchRoles(all));
     if (compatibles == LFG_COMPATIBILITY_PENDING) // Not previously cached, calculate
@@ -334,7 +387,7 @@ LfgCompatibility LFGQueue::FindNewGroups(GuidList& check, GuidList& all)
     if (compatibles == LFG_COMPATIBLES_BAD_STATES && sLFGMgr->AllQueued(check))
     {
         TC_LOG_DEBUG("lfg.queue.match.check", "Guids: ({}) compatibles (cached) changed from bad states to match", GetDetailedMatchRoles(check));
-        SetCompatibles(strGuids, LFG_COMPATIBLES_MATCH);
+        SetCompatibles(key, LFG_COMPATIBLES_MATCH);
         return LFG_COMPATIBLES_MATCH;
     }
 
@@ -362,7 +415,7 @@ LfgCompatibility LFGQueue::FindNewGroups(GuidList& check, GuidList& all)
 */
 LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
 {
-    std::string strGuids = ConcatenateGuids(check);
+    LfgCompatibilityKey key = MakeCompatibilityKey(check);
     LfgProposal proposal;
     LfgDungeonSet proposalDungeons;
     LfgGroupsMap proposalGroups;
@@ -385,8 +438,8 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         LfgCompatibility child_compatibles = CheckCompatibility(check);
         if (child_compatibles < LFG_COMPATIBLES_WITH_LESS_PLAYERS) // Group not compatible
         {
-            TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) child {} not compatibles", strGuids, GetDetailedMatchRoles(check));
-            SetCompatibles(strGuids, child_compatibles);
+            TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) child {} not compatibles", GetCompatibilityKeyString(key), GetDetailedMatchRoles(check));
+            SetCompatibles(key, child_compatibles);
             return child_compatibles;
         }
         check.push_front(frontGuid);
@@ -430,22 +483,22 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         data.roles = itQueue->second.roles;
         LFGMgr::CheckGroupRoles(data.roles);
 
-        UpdateBestCompatibleInQueue(itQueue, strGuids, data.roles);
-        SetCompatibilityData(strGuids, data);
+        UpdateBestCompatibleInQueue(itQueue, key, data.roles);
+        SetCompatibilityData(key, data);
         return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
     }
 
     if (numLfgGroups > 1)
     {
         TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) More than one Lfggroup ({})", GetDetailedMatchRoles(check), numLfgGroups);
-        SetCompatibles(strGuids, LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS);
+        SetCompatibles(key, LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS);
         return LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS;
     }
 
     if (numPlayers > MAX_GROUP_SIZE)
     {
         TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Too many players ({})", GetDetailedMatchRoles(check), numPlayers);
-        SetCompatibles(strGuids, LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS);
+        SetCompatibles(key, LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS);
         return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
     }
 
@@ -473,7 +526,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         if (uint8 playersize = numPlayers - proposalRoles.size())
         {
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) not compatible, {} players are ignoring each other", GetDetailedMatchRoles(check), playersize);
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_HAS_IGNORES);
+            SetCompatibles(key, LFG_INCOMPATIBLES_HAS_IGNORES);
             return LFG_INCOMPATIBLES_HAS_IGNORES;
         }
 
@@ -485,27 +538,34 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
                 o << ", " << it->first.ToHexString() << ": " << GetRolesString(it->second);
 
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Roles not compatible{}", GetDetailedMatchRoles(check), o.str());
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_NO_ROLES);
+            SetCompatibles(key, LFG_INCOMPATIBLES_NO_ROLES);
             return LFG_INCOMPATIBLES_NO_ROLES;
         }
 
-        GuidList::iterator itguid = check.begin();
-        proposalDungeons = QueueDataStore[*itguid].dungeons;
-        std::ostringstream o;
-        o << ", " << itguid->ToHexString() << ": (" << ConcatenateDungeons(proposalDungeons) << ")";
-        for (++itguid; itguid != check.end(); ++itguid)
+        // dungeon masks have a common bit for every dungeon selected by all, skip intersecting sets when there is none
+        uint64 dungeonMask = ~UI64LIT(0);
+        for (ObjectGuid const& guid : check)
+            dungeonMask &= QueueDataStore[guid].dungeonMask;
+
+        if (dungeonMask)
         {
-            LfgDungeonSet temporal;
-            LfgDungeonSet& dungeons = QueueDataStore[*itguid].dungeons;
-            o << ", " << itguid->ToHexString() << ": (" << ConcatenateDungeons(dungeons) << ")";
-            std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
-            proposalDungeons = temporal;
+            GuidList::iterator itguid = check.begin();
+            proposalDungeons = QueueDataStore[*itguid].dungeons;
+            for (++itguid; itguid != check.end() && !proposalDungeons.empty(); ++itguid)
+            {
+                LfgDungeonSet const& dungeons = QueueDataStore[*itguid].dungeons;
+                std::erase_if(proposalDungeons, [&dungeons](uint32 dungeonId) { return !dungeons.contains(dungeonId); });
+            }
         }
 
         if (proposalDungeons.empty())
         {
+            std::ostringstream o;
+            for (ObjectGuid const& guid : check)
+                o << ", " << guid.ToHexString() << ": (" << ConcatenateDungeons(QueueDataStore[guid].dungeons) << ")";
+
             TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) No compatible dungeons{}", GetDetailedMatchRoles(check), o.str());
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_NO_DUNGEONS);
+            SetCompatibles(key, LFG_INCOMPATIBLES_NO_DUNGEONS);
             return LFG_INCOMPATIBLES_NO_DUNGEONS;
         }
     }
@@ -526,9 +586,9 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
         data.roles = proposalRoles;
 
         for (GuidList::const_iterator itr = check.begin(); itr != check.end(); ++itr)
-            UpdateBestCompatibleInQueue(QueueDataStore.find(*itr), strGuids, data.roles);
+            UpdateBestCompatibleInQueue(QueueDataStore.find(*itr), key, data.roles);
 
-        SetCompatibilityData(strGuids, data);
+        SetCompatibilityData(key, data);
         return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
     }
 
@@ -539,7 +599,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
     if (!sLFGMgr->AllQueued(check))
     {
         TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) Group MATCH but can't create proposal!", GetDetailedMatchRoles(check));
-        SetCompatibles(strGuids, LFG_COMPATIBLES_BAD_STATES);
+        SetCompatibles(key, LFG_COMPATIBLES_BAD_STATES);
         return LFG_COMPATIBLES_BAD_STATES;
     }
 
@@ -581,7 +641,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(GuidList check)
     sLFGMgr->AddProposal(proposal);
 
     TC_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: ({}) MATCH! Group formed", GetDetailedMatchRoles(check));
-    SetCompatibles(strGuids, LFG_COMPATIBLES_MATCH);
+    SetCompatibles(key, LFG_COMPATIBLES_MATCH);
     return LFG_COMPATIBLES_MATCH;
 }
 
@@ -623,7 +683,7 @@ void LFGQueue::UpdateQueueTimers(uint8 queueId, time_t currTime)
                 break;
         }
 
-        if (queueinfo.bestCompatible.empty())
+        if (queueinfo.bestCompatible.IsEmpty())
             FindBestCompatibleInQueue(itQueue);
 
         LfgQueueStatusData queueData(queueId, dungeonId, waitTime, wtAvg, wtTank, wtHealer, wtDps, queuedTime, queueinfo.tanks, queueinfo.healers, queueinfo.dps);
@@ -677,7 +737,7 @@ std::string LFGQueue::DumpCompatibleInfo(bool full /* = false */) const
     if (full)
         for (LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.begin(); itr != CompatibleMapStore.end(); ++itr)
         {
-            o << "(" << itr->first << "): " << GetCompatibleString(itr->second.compatibility);
+            o << "(" << GetCompatibilityKeyString(itr->first) << "): " << GetCompatibleString(itr->second.compatibility);
             if (!itr->second.roles.empty())
             {
                 o << " (";
@@ -700,30 +760,24 @@ std::string LFGQueue::DumpCompatibleInfo(bool full /* = false */) const
 void LFGQueue::FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue)
 {
     TC_LOG_DEBUG("lfg.queue.compatibles.find", "{}", itrQueue->first.ToString());
-    std::string sguid = itrQueue->first.ToHexString();
+    uint32 slot = itrQueue->second.slot;
 
     for (LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.begin(); itr != CompatibleMapStore.end(); ++itr)
-        if (itr->second.compatibility == LFG_COMPATIBLES_WITH_LESS_PLAYERS &&
-            std::string::npos != itr->first.find(sguid))
+        if (itr->second.compatibility == LFG_COMPATIBLES_WITH_LESS_PLAYERS && itr->first.Contains(slot))
         {
             UpdateBestCompatibleInQueue(itrQueue, itr->first, itr->second.roles);
         }
 }
 
-void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, std::string const& key, LfgRolesMap const& roles)
+void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, LfgCompatibilityKey const& key, LfgRolesMap const& roles)
 {
     LfgQueueData& queueData = itrQueue->second;
 
-    uint8 storedSize = queueData.bestCompatible.empty() ? 0 :
-        std::count(queueData.bestCompatible.begin(), queueData.bestCompatible.end(), '|') + 1;
-
-    uint8 size = std::count(key.begin(), key.end(), '|') + 1;
-
-    if (size <= storedSize)
+    if (key.GetCount() <= queueData.bestCompatible.GetCount())
         return;
 
     TC_LOG_DEBUG("lfg.queue.compatibles.update", "Changed ({}) to ({}) as best compatible group for {}",
-        queueData.bestCompatible, key, itrQueue->first.ToString());
+        GetCompatibilityKeyString(queueData.bestCompatible), GetCompatibilityKeyString(key), itrQueue->first.ToString());
 
     queueData.bestCompatible = key;
     queueData.tanks = LFG_TANKS_NEEDED;
@@ -19,7 +19,9 @@
 #define _LFGQUEUE_H
 
 #include "LFG.h"
+#include <array>
 #include <list>
+#include <unordered_map>
 
 namespace lfg
 {
@@ -38,6 +40,27 @@ enum LfgCompatibility
     LFG_COMPATIBLES_MATCH                                  // Must be the last one
 };
 
+/// Queue slots of players and groups checked together, sorted so the same members always give the same key
+struct LfgCompatibilityKey
+{
+    static constexpr std::size_t MaxSlots = LFG_TANKS_NEEDED + LFG_HEALERS_NEEDED + LFG_DPS_NEEDED;
+
+    void Add(uint32 slot);
+    bool Contains(uint32 slot) const;
+    uint8 GetCount() const { return count; }
+    bool IsEmpty() const { return !count; }
+
+    bool operator==(LfgCompatibilityKey const& right) const = default;
+
+    std::array<uint32, MaxSlots> slots = { };
+    uint8 count = 0;
+};
+
+struct LfgCompatibilityKeyHash
+{
+    std::size_t operator()(LfgCompatibilityKey const& key) const;
+};
+
 struct LfgCompatibilityData
 {
     LfgCompatibilityData(): compatibility(LFG_COMPATIBILITY_PENDING) { }
@@ -54,18 +77,17 @@ struct LfgQueueData
 {
     LfgQueueData();
 
-    LfgQueueData(time_t _joinTime, LfgDungeonSet const& _dungeons, LfgRolesMap const& _roles):
-        joinTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
-        dps(LFG_DPS_NEEDED), dungeons(_dungeons), roles(_roles)
-        { }
+    LfgQueueData(uint32 _slot, time_t _joinTime, LfgDungeonSet const& _dungeons, LfgRolesMap const& _roles);
 
+    uint32 slot;                                           ///< Queue slot, identifies Player/Group in compatibility keys
     time_t joinTime;                                       ///< Player queue join time (to calculate wait times)
     uint8 tanks;                                           ///< Tanks needed
     uint8 healers;                                         ///< Healers needed
     uint8 dps;                                             ///< Dps needed
     LfgDungeonSet dungeons;                                ///< Selected Player/Group Dungeon/s
+    uint64 dungeonMask;                                    ///< Bit (dungeon id % 64) set for every selected dungeon, groups without common bits can't share a dungeon
     LfgRolesMap roles;                                     ///< Selected Player Role/s
-    std::string bestCompatible;                            ///< Best compatible combination of people queued
+    LfgCompatibilityKey bestCompatible;                    ///< Best compatible combination of people queued
 };
 
 struct LfgWaitTime
@@ -76,7 +98,7 @@ struct LfgWaitTime
 };
 
 typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
-typedef std::map<std::string, LfgCompatibilityData> LfgCompatibleContainer;
+typedef std::unordered_map<LfgCompatibilityKey, LfgCompatibilityData, LfgCompatibilityKeyHash> LfgCompatibleContainer;
 typedef std::map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
 
 /**
@@ -123,14 +145,17 @@ class TC_GAME_API LFGQueue
         void RemoveFromNewQueue(ObjectGuid guid);
         void RemoveFromCurrentQueue(ObjectGuid guid);
 
-        void SetCompatibles(std::string const& key, LfgCompatibility compatibles);
-        LfgCompatibility GetCompatibles(std::string const& key);
-        void RemoveFromCompatibles(ObjectGuid guid);
+        LfgCompatibilityKey MakeCompatibilityKey(GuidList const& check) const;
+        std::string GetCompatibilityKeyString(LfgCompatibilityKey const& key) const;
+
+        void SetCompatibles(LfgCompatibilityKey const& key, LfgCompatibility compatibles);
+        LfgCompatibility GetCompatibles(LfgCompatibilityKey const& key);
+        void RemoveFromCompatibles(uint32 slot);
 
-        void SetCompatibilityData(std::string const& key, LfgCompatibilityData const& compatibles);
-        LfgCompatibilityData* GetCompatibilityData(std::string const& key);
+        void SetCompatibilityData(LfgCompatibilityKey const& key, LfgCompatibilityData const& compatibles);
+        LfgCompatibilityData* GetCompatibilityData(LfgCompatibilityKey const& key);
         void FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue);
-        void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, std::string const& key, LfgRolesMap const& roles);
+        void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, LfgCompatibilityKey const& key, LfgRolesMap const& roles);
 
         LfgCompatibility FindNewGroups(GuidList& check, GuidList& all);
         LfgCompatibility CheckCompatibility(GuidList check);
@@ -138,6 +163,7 @@ class TC_GAME_API LFGQueue
         // Queue
         LfgQueueDataContainer QueueDataStore;              ///< Queued groups
         LfgCompatibleContainer CompatibleMapStore;         ///< Compatible dungeons
+        uint32 NextQueueSlot;                              ///< Slot given to next queued Player/Group, never reused
 
         LfgWaitTimesContainer waitTimesAvgStore;           ///< Average wait time to find a group queuing as multiple roles
         LfgWaitTimesContainer waitTimesTankStore;          ///< Average wait time to find a group queuing as tank
@@ -67,6 +67,7 @@ class TC_GAME_API AreaTrigger final : public WorldObject, public GridObject<Area
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
+        void UpdatePackedGridPosition() override { UpdateGridPosition(); }
 
         void AI_Initialize();
         void AI_Destroy();
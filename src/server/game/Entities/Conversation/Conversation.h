@@ -54,6 +54,7 @@ class TC_GAME_API Conversation final : public WorldObject, public GridObject<Con
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
+        void UpdatePackedGridPosition() override { UpdateGridPosition(); }
 
         void Update(uint32 diff) override;
         void Remove();
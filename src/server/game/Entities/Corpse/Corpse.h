@@ -77,6 +77,7 @@ class TC_GAME_API Corpse final : public WorldObject, public GridObject<Corpse>
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
+        void UpdatePackedGridPosition() override { UpdateGridPosition(); }
 
         bool Create(ObjectGuid::LowType guidlow, Map* map);
         bool Create(ObjectGuid::LowType guidlow, Player* owner);
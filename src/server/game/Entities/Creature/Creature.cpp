@@ -49,6 +49,7 @@
 #include "Spell.h"
 #include "SpellAuraEffects.h"
 #include "SpellMgr.h"
+#include "StartupSnapshot.h"
 #include "TemporarySummon.h"
 #include "Vehicle.h"
 #include "World.h"
@@ -1598,6 +1599,7 @@ void Creature::SaveToDB(uint32 mapid, std::vector<Difficulty> const& spawnDiffic
     trans->Append(stmt);
 
     WorldDatabase.CommitTransaction(trans);
+    sStartupSnapshot->Invalidate(ObjectMgr::CreatureSnapshotName);
 }
 
 void Creature::SelectLevel()
@@ -2072,6 +2074,7 @@ bool Creature::hasInvolvedQuest(uint32 quest_id) const
     trans->Append(stmt);
 
     WorldDatabase.CommitTransaction(trans);
+    sStartupSnapshot->Invalidate(ObjectMgr::CreatureSnapshotName);
 
     return true;
 }
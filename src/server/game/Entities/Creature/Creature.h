@@ -86,6 +86,7 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
+        void UpdatePackedGridPosition() override { UpdateGridPosition(); }
 
         float GetNativeObjectScale() const override;
         void SetObjectScale(float scale) override;
@@ -61,6 +61,7 @@ class TC_GAME_API DynamicObject final : public WorldObject, public GridObject<Dy
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
+        void UpdatePackedGridPosition() override { UpdateGridPosition(); }
 
         bool CreateDynamicObject(ObjectGuid::LowType guidlow, Unit* caster, SpellInfo const* spell, Position const& pos, float radius, DynamicObjectType type, SpellCastVisual spellVisual);
         void Update(uint32 p_time) override;
@@ -52,6 +52,7 @@
 #include "QueryPackets.h"
 #include "SpellAuras.h"
 #include "SpellMgr.h"
+#include "StartupSnapshot.h"
 #include "Transport.h"
 #include "Util.h"
 #include "Vignette.h"
@@ -1941,6 +1942,7 @@ void GameObject::SaveToDB(uint32 mapid, std::vector<Difficulty> const& spawnDiff
     trans->Append(stmt);
 
     WorldDatabase.CommitTransaction(trans);
+    sStartupSnapshot->Invalidate(ObjectMgr::GameObjectSnapshotName);
 }
 
 bool GameObject::LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap, bool)
@@ -2084,6 +2086,7 @@ bool GameObject::LoadFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap
     trans->Append(stmt);
 
     WorldDatabase.CommitTransaction(trans);
+    sStartupSnapshot->Invalidate(ObjectMgr::GameObjectSnapshotName);
 
     return true;
 }
@@ -190,6 +190,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
+        void UpdatePackedGridPosition() override { UpdateGridPosition(); }
         void CleanupsBeforeDelete(bool finalCleanup = true) override;
 
     private:
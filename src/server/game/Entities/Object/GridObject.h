@@ -30,6 +30,8 @@ class GridObject
         bool IsInGrid() const { return _gridRef.isValid(); }
         void AddToGrid(GridRefManager<T>& m) { ASSERT(!IsInGrid()); _gridRef.link(&m, (T*)this); }
         void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.unlink(); }
+        // refreshes position and combat reach copied into the grid, see GridRefManager::AddPacked
+        void UpdateGridPosition() { if (IsInGrid()) _gridRef.UpdatePackedPosition(); }
     private:
         GridReference<T> _gridRef;
 };
@@ -210,8 +210,12 @@ void Object::SendUpdateToPlayer(Player* player)
 void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player const* target) const
 {
     ByteBuffer& buf = PrepareValuesUpdateBuffer(data);
+    BuildValuesUpdateBlock(buf, GetUpdateFieldFlagsFor(target), target);
+    data->AddUpdateBlock();
+}
 
-    EnumFlag<UF::UpdateFieldFlag> fieldFlags = GetUpdateFieldFlagsFor(target);
+void Object::BuildValuesUpdateBlock(ByteBuffer& buf, EnumFlag<UF::UpdateFieldFlag> fieldFlags, Player const* target) const
+{
     std::size_t sizePos = buf.wpos();
     buf << uint32(0);
     buf << uint8(fieldFlags.HasFlag(UF::UpdateFieldFlag::Owner));
@@ -225,8 +229,6 @@ void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player const* tar
 
     BuildValuesUpdate(&buf, fieldFlags, target);
     buf.put<uint32>(sizePos, buf.wpos() - sizePos - 4);
-
-    data->AddUpdateBlock();
 }
 
 void Object::BuildValuesUpdateBlockForPlayerWithFlag(UpdateData* data, UF::UpdateFieldFlag flags, Player const* target) const
@@ -866,6 +868,71 @@ void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) cons
     BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
 }
 
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, ValuesUpdateBlockCache& cache) const
+{
+    UpdateDataMapType::iterator iter = data_map.try_emplace(player, player->GetMapId()).first;
+
+    // active player fields are only sent to the player itself, never share that block
+    if (player == this)
+    {
+        BuildValuesUpdateBlockForPlayer(&iter->second, player);
+        return;
+    }
+
+    UF::UpdateFieldFlag fieldFlags = GetUpdateFieldFlagsFor(player);
+    ValuesUpdateBlockCache::Entry const& entry = cache.Get(fieldFlags, player, [&](ByteBuffer& block, Player const* receiver)
+    {
+        BuildValuesUpdateBlock(block, fieldFlags, receiver);
+    });
+
+    if (!entry.CanAppendFor(player))
+    {
+        BuildValuesUpdateBlockForPlayer(&iter->second, player);
+        return;
+    }
+
+    entry.AppendTo(PrepareValuesUpdateBuffer(&iter->second), player);
+    iter->second.AddUpdateBlock();
+}
+
+void ValuesUpdateBlockCache::Entry::AppendTo(ByteBuffer& buffer, Player const* receiver) const
+{
+    std::size_t blockPos = buffer.wpos();
+    buffer.append(Block);
+    for (UF::ViewerDependentValueRecorder::Slot const& slot : ViewerDependentValues)
+        slot.Patch(buffer, blockPos + slot.Position, slot.Data, slot.Owner, receiver);
+}
+
+ValuesUpdateBlockCache& ValuesUpdateBlockCache::AcquireForCurrentThread()
+{
+    thread_local ValuesUpdateBlockCache cache;
+    cache._size = 0;
+    return cache;
+}
+
+ValuesUpdateBlockCache::Entry* ValuesUpdateBlockCache::Find(UF::UpdateFieldFlag flags)
+{
+    for (std::size_t i = 0; i < _size; ++i)
+        if (_entries[i].Flags == flags)
+            return &_entries[i];
+
+    return nullptr;
+}
+
+ValuesUpdateBlockCache::Entry& ValuesUpdateBlockCache::Add(UF::UpdateFieldFlag flags)
+{
+    if (_size == _entries.size())
+        _entries.emplace_back();
+
+    Entry& entry = _entries[_size++];
+    entry.Flags = flags;
+    entry.Shareable = false;
+    entry.BuiltFor = nullptr;
+    entry.Block.clear();
+    entry.ViewerDependentValues.clear();
+    return entry;
+}
+
 std::string Object::GetDebugInfo() const
 {
     std::stringstream sstr;
@@ -3774,9 +3841,10 @@ void WorldObject::UpdateObjectVisibility(bool /*forced*/)
 struct WorldObjectChangeAccumulator
 {
     UpdateDataMapType& i_updateDatas;
+    ValuesUpdateBlockCache& i_blockCache;
     WorldObject& i_object;
     GuidSet plr_list;
-    WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d) : i_updateDatas(d), i_object(obj) { }
+    WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d, ValuesUpdateBlockCache& blockCache) : i_updateDatas(d), i_blockCache(blockCache), i_object(obj) { }
     void Visit(PlayerMapType &m)
     {
         Player* source = nullptr;
@@ -3833,7 +3901,7 @@ struct WorldObjectChangeAccumulator
         // Only send update once to a player
         if (plr_list.find(player->GetGUID()) == plr_list.end() && player->HaveAtClient(&i_object))
         {
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
+            i_object.BuildFieldsUpdate(player, i_updateDatas, i_blockCache);
             plr_list.insert(player->GetGUID());
         }
     }
@@ -3843,7 +3911,7 @@ struct WorldObjectChangeAccumulator
 
 void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
 {
-    WorldObjectChangeAccumulator notifier(*this, data_map);
+    WorldObjectChangeAccumulator notifier(*this, data_map, ValuesUpdateBlockCache::AcquireForCurrentThread());
     //we must build packets for all visible players
     Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
 
@@ -34,6 +34,7 @@
 #include "SpellDefines.h"
 #include "UniqueTrackablePtr.h"
 #include "UpdateFields.h"
+#include "ViewerDependentValueRecorder.h"
 #include "WowCSEntityDefinitions.h"
 #include <list>
 #include <unordered_map>
@@ -80,6 +81,53 @@ namespace WorldPackets
 
 typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
 
+// Values update blocks of a single object, built once per UpdateFieldFlag combination and copied for every viewer sharing it
+class TC_GAME_API ValuesUpdateBlockCache
+{
+public:
+    struct Entry
+    {
+        UF::UpdateFieldFlag Flags = UF::UpdateFieldFlag::None;
+        bool Shareable = false;
+        Player const* BuiltFor = nullptr;
+        ByteBuffer Block;
+        std::vector<UF::ViewerDependentValueRecorder::Slot> ViewerDependentValues;
+
+        // vector values depend on the viewer and cannot be rewritten in place, such blocks are only valid for the viewer they were built for
+        bool CanAppendFor(Player const* receiver) const { return Shareable || BuiltFor == receiver; }
+
+        // copies the block and rewrites viewer dependent values for receiver
+        void AppendTo(ByteBuffer& buffer, Player const* receiver) const;
+    };
+
+    // returns block built for flags, calling build(ByteBuffer&, Player const* receiver) if there is none yet
+    template<typename Builder>
+    Entry& Get(UF::UpdateFieldFlag flags, Player const* receiver, Builder&& build)
+    {
+        if (Entry* entry = Find(flags))
+            return *entry;
+
+        Entry& entry = Add(flags);
+        UF::ViewerDependentValueRecorder recorder(entry.Block);
+        build(entry.Block, receiver);
+        entry.Shareable = recorder.IsPatchable();
+        entry.BuiltFor = receiver;
+        std::swap(entry.ViewerDependentValues, recorder.GetSlots());
+        return entry;
+    }
+
+    // cache of the calling thread, emptied - blocks must not outlive the update of a single object
+    // buffers are kept allocated for reuse by the next object
+    static ValuesUpdateBlockCache& AcquireForCurrentThread();
+
+private:
+    Entry* Find(UF::UpdateFieldFlag flags);
+    Entry& Add(UF::UpdateFieldFlag flags);
+
+    std::vector<Entry> _entries;
+    std::size_t _size = 0;
+};
+
 struct CreateObjectBits
 {
     bool NoBirthAnim : 1;
@@ -217,6 +265,7 @@ class TC_GAME_API Object
         void BuildDestroyUpdateBlock(UpdateData* data) const;
         void BuildOutOfRangeUpdateBlock(UpdateData* data) const;
         ByteBuffer& PrepareValuesUpdateBuffer(UpdateData* data) const;
+        void BuildValuesUpdateBlock(ByteBuffer& buf, EnumFlag<UF::UpdateFieldFlag> fieldFlags, Player const* target) const;
 
         virtual void DestroyForPlayer(Player* target) const;
         void SendOutOfRangeForPlayer(Player* target) const;
@@ -232,6 +281,7 @@ class TC_GAME_API Object
         void SetDestroyedObject(bool destroyed) { m_isDestroyedObject = destroyed; }
         virtual void BuildUpdate(UpdateDataMapType&) { }
         void BuildFieldsUpdate(Player*, UpdateDataMapType &) const;
+        void BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, ValuesUpdateBlockCache& cache) const;
 
         inline bool IsWorldObject() const { return isType(TYPEMASK_WORLDOBJECT); }
         static WorldObject* ToWorldObject(Object* o) { return o ? o->ToWorldObject() : nullptr; }
@@ -661,6 +711,14 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         void GetContactPoint(WorldObject const* obj, float& x, float& y, float& z, float distance2d = CONTACT_DISTANCE) const;
 
         virtual float GetCombatReach() const { return 0.0f; } // overridden (only) in Unit
+
+        // hide Position::Relocate - objects stored in grids keep a copy of their position for range searches
+        void Relocate(float x, float y) { Position::Relocate(x, y); UpdatePackedGridPosition(); }
+        void Relocate(float x, float y, float z) { Position::Relocate(x, y, z); UpdatePackedGridPosition(); }
+        void Relocate(float x, float y, float z, float o) { Position::Relocate(x, y, z, o); UpdatePackedGridPosition(); }
+        void Relocate(Position const& pos) { Position::Relocate(pos); UpdatePackedGridPosition(); }
+        void Relocate(Position const* pos) { Position::Relocate(pos); UpdatePackedGridPosition(); }
+        virtual void UpdatePackedGridPosition() { }
         void UpdateGroundPositionZ(float x, float y, float &z) const;
         void UpdateAllowedPositionZ(float x, float y, float &z, float* groundZ = nullptr) const;
 
@@ -0,0 +1,41 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ViewerDependentValueRecorder.h"
+
+namespace
+{
+thread_local UF::ViewerDependentValueRecorder* CurrentRecorder = nullptr;
+}
+
+namespace UF
+{
+ViewerDependentValueRecorder::ViewerDependentValueRecorder(ByteBuffer const& buffer) : _buffer(buffer), _patchable(true), _previous(CurrentRecorder)
+{
+    CurrentRecorder = this;
+}
+
+ViewerDependentValueRecorder::~ViewerDependentValueRecorder()
+{
+    CurrentRecorder = _previous;
+}
+
+ViewerDependentValueRecorder* ViewerDependentValueRecorder::GetCurrent()
+{
+    return CurrentRecorder;
+}
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ViewerDependentValueRecorder_h__
+#define ViewerDependentValueRecorder_h__
+
+#include "Define.h"
+#include "ByteBuffer.h"
+#include <type_traits>
+#include <vector>
+
+class Object;
+class Player;
+
+namespace UF
+{
+/*
+ * Records positions of viewer dependent values (see ViewerDependentValues.h) written into a values
+ * update block while it is alive on the current thread.
+ * The block built for one viewer can then be copied for other viewers with the same UpdateFieldFlag
+ * and only the recorded values rewritten for them.
+ */
+class TC_GAME_API ViewerDependentValueRecorder
+{
+public:
+    using Patcher = void(*)(ByteBuffer& buffer, std::size_t position, void const* data, Object const* owner, Player const* receiver);
+
+    struct Slot
+    {
+        std::size_t Position;
+        void const* Data;
+        Object const* Owner;
+        Patcher Patch;
+    };
+
+    explicit ViewerDependentValueRecorder(ByteBuffer const& buffer);
+    ~ViewerDependentValueRecorder();
+
+    ViewerDependentValueRecorder(ViewerDependentValueRecorder const&) = delete;
+    ViewerDependentValueRecorder& operator=(ViewerDependentValueRecorder const&) = delete;
+
+    static ViewerDependentValueRecorder* GetCurrent();
+
+    template<typename Value>
+    void Record(void const* data, Object const* owner, Patcher patch)
+    {
+        // only fixed size values written at byte boundary can be rewritten in place
+        if constexpr (std::is_arithmetic_v<Value>)
+        {
+            if (!_buffer.HasUnfinishedBitPack())
+            {
+                _slots.push_back({ .Position = _buffer.wpos(), .Data = data, .Owner = owner, .Patch = patch });
+                return;
+            }
+        }
+
+        _patchable = false;
+    }
+
+    bool IsPatchable() const { return _patchable; }
+    std::vector<Slot>& GetSlots() { return _slots; }
+
+private:
+    ByteBuffer const& _buffer;
+    std::vector<Slot> _slots;
+    bool _patchable;
+    ViewerDependentValueRecorder* _previous;
+};
+}
+
+#endif // ViewerDependentValueRecorder_h__
@@ -28,18 +28,19 @@
 #include "SpellInfo.h"
 #include "SpellMgr.h"
 #include "TemporarySummon.h"
+#include "ViewerDependentValueRecorder.h"
 #include "World.h"
 #include "WorldSession.h"
 
 namespace UF
 {
 template<typename Tag>
-class ViewerDependentValue
+class ViewerDependentValueImpl
 {
 };
 
 template<>
-class ViewerDependentValue<UF::ObjectData::EntryIDTag>
+class ViewerDependentValueImpl<UF::ObjectData::EntryIDTag>
 {
 public:
     using value_type = UF::ObjectData::EntryIDTag::value_type;
@@ -58,7 +59,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::ObjectData::DynamicFlagsTag>
+class ViewerDependentValueImpl<UF::ObjectData::DynamicFlagsTag>
 {
 public:
     using value_type = UF::ObjectData::DynamicFlagsTag::value_type;
@@ -158,7 +159,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::DisplayIDTag>
+class ViewerDependentValueImpl<UF::UnitData::DisplayIDTag>
 {
 public:
     using value_type = UF::UnitData::DisplayIDTag::value_type;
@@ -208,7 +209,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::StateWorldEffectIDsTag>
+class ViewerDependentValueImpl<UF::UnitData::StateWorldEffectIDsTag>
 {
 public:
     using value_type = UF::UnitData::StateWorldEffectIDsTag::value_type const*;
@@ -224,7 +225,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::StateSpellVisualIDTag>
+class ViewerDependentValueImpl<UF::UnitData::StateSpellVisualIDTag>
 {
 public:
     using value_type = UF::UnitData::StateSpellVisualIDTag::value_type;
@@ -242,7 +243,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::StateAnimIDTag>
+class ViewerDependentValueImpl<UF::UnitData::StateAnimIDTag>
 {
 public:
     using value_type = UF::UnitData::StateAnimIDTag::value_type;
@@ -260,7 +261,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::StateAnimKitIDTag>
+class ViewerDependentValueImpl<UF::UnitData::StateAnimKitIDTag>
 {
 public:
     using value_type = UF::UnitData::StateAnimKitIDTag::value_type;
@@ -278,7 +279,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::StateWorldEffectsQuestObjectiveIDTag>
+class ViewerDependentValueImpl<UF::UnitData::StateWorldEffectsQuestObjectiveIDTag>
 {
 public:
     using value_type = UF::UnitData::StateWorldEffectsQuestObjectiveIDTag::value_type;
@@ -314,7 +315,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::FactionTemplateTag>
+class ViewerDependentValueImpl<UF::UnitData::FactionTemplateTag>
 {
 public:
     using value_type = UF::UnitData::FactionTemplateTag::value_type;
@@ -336,7 +337,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::FlagsTag>
+class ViewerDependentValueImpl<UF::UnitData::FlagsTag>
 {
 public:
     using value_type = UF::UnitData::FlagsTag::value_type;
@@ -353,7 +354,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::Flags2Tag>
+class ViewerDependentValueImpl<UF::UnitData::Flags2Tag>
 {
 public:
     using value_type = UF::UnitData::Flags2Tag::value_type;
@@ -370,7 +371,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::Flags3Tag>
+class ViewerDependentValueImpl<UF::UnitData::Flags3Tag>
 {
 public:
     using value_type = UF::UnitData::Flags3Tag::value_type;
@@ -386,7 +387,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::Flags4Tag>
+class ViewerDependentValueImpl<UF::UnitData::Flags4Tag>
 {
 public:
     using value_type = UF::UnitData::Flags4Tag::value_type;
@@ -398,7 +399,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::AuraStateTag>
+class ViewerDependentValueImpl<UF::UnitData::AuraStateTag>
 {
 public:
     using value_type = UF::UnitData::AuraStateTag::value_type;
@@ -411,7 +412,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::PvpFlagsTag>
+class ViewerDependentValueImpl<UF::UnitData::PvpFlagsTag>
 {
 public:
     using value_type = UF::UnitData::PvpFlagsTag::value_type;
@@ -433,7 +434,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::InteractSpellIDTag>
+class ViewerDependentValueImpl<UF::UnitData::InteractSpellIDTag>
 {
 public:
     using value_type = UF::UnitData::InteractSpellIDTag::value_type;
@@ -463,7 +464,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::NpcFlagsTag>
+class ViewerDependentValueImpl<UF::UnitData::NpcFlagsTag>
 {
 public:
     using value_type = UF::UnitData::NpcFlagsTag::value_type;
@@ -490,7 +491,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::UnitData::NpcFlags2Tag>
+class ViewerDependentValueImpl<UF::UnitData::NpcFlags2Tag>
 {
 public:
     using value_type = UF::UnitData::NpcFlags2Tag::value_type;
@@ -509,7 +510,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::GameObjectData::StateWorldEffectIDsTag>
+class ViewerDependentValueImpl<UF::GameObjectData::StateWorldEffectIDsTag>
 {
 public:
     using value_type = UF::GameObjectData::StateWorldEffectIDsTag::value_type const*;
@@ -524,7 +525,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::GameObjectData::StateSpellVisualIDTag>
+class ViewerDependentValueImpl<UF::GameObjectData::StateSpellVisualIDTag>
 {
 public:
     using value_type = UF::GameObjectData::StateSpellVisualIDTag::value_type;
@@ -541,7 +542,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::GameObjectData::SpawnTrackingStateAnimIDTag>
+class ViewerDependentValueImpl<UF::GameObjectData::SpawnTrackingStateAnimIDTag>
 {
 public:
     using value_type = UF::GameObjectData::SpawnTrackingStateAnimIDTag::value_type;
@@ -558,7 +559,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::GameObjectData::SpawnTrackingStateAnimKitIDTag>
+class ViewerDependentValueImpl<UF::GameObjectData::SpawnTrackingStateAnimKitIDTag>
 {
 public:
     using value_type = UF::GameObjectData::SpawnTrackingStateAnimKitIDTag::value_type;
@@ -575,7 +576,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::GameObjectData::StateWorldEffectsQuestObjectiveIDTag>
+class ViewerDependentValueImpl<UF::GameObjectData::StateWorldEffectsQuestObjectiveIDTag>
 {
 public:
     using value_type = UF::GameObjectData::StateWorldEffectsQuestObjectiveIDTag::value_type;
@@ -611,7 +612,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::GameObjectData::FlagsTag>
+class ViewerDependentValueImpl<UF::GameObjectData::FlagsTag>
 {
 public:
     using value_type = UF::GameObjectData::FlagsTag::value_type;
@@ -628,7 +629,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::GameObjectData::StateTag>
+class ViewerDependentValueImpl<UF::GameObjectData::StateTag>
 {
 public:
     using value_type = UF::GameObjectData::StateTag::value_type;
@@ -640,7 +641,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::ConversationData::LastLineEndTimeTag>
+class ViewerDependentValueImpl<UF::ConversationData::LastLineEndTimeTag>
 {
 public:
     using value_type = UF::ConversationData::LastLineEndTimeTag::value_type;
@@ -653,7 +654,7 @@ public:
 };
 
 template<>
-class ViewerDependentValue<UF::ConversationLine::StartTimeTag>
+class ViewerDependentValueImpl<UF::ConversationLine::StartTimeTag>
 {
 public:
     using value_type = UF::ConversationLine::StartTimeTag::value_type;
@@ -669,6 +670,31 @@ public:
         return startTime;
     }
 };
+
+// Entry point used by update field serialization, lets ViewerDependentValueRecorder remember where the value is written
+template<typename Tag>
+class ViewerDependentValue
+{
+public:
+    using value_type = typename ViewerDependentValueImpl<Tag>::value_type;
+
+    template<typename Data, typename Owner>
+    static value_type GetValue(Data const* data, Owner const* owner, Player const* receiver)
+    {
+        if (ViewerDependentValueRecorder* recorder = ViewerDependentValueRecorder::GetCurrent())
+            recorder->Record<value_type>(data, owner, &Patch<Data, Owner>);
+
+        return ViewerDependentValueImpl<Tag>::GetValue(data, owner, receiver);
+    }
+
+private:
+    template<typename Data, typename Owner>
+    static void Patch(ByteBuffer& buffer, std::size_t position, void const* data, Object const* owner, Player const* receiver)
+    {
+        if constexpr (std::is_arithmetic_v<value_type>)
+            buffer.put<value_type>(position, ViewerDependentValueImpl<Tag>::GetValue(static_cast<Data const*>(data), static_cast<Owner const*>(owner), receiver));
+    }
+};
 }
 
 #endif // ViewerDependentValues_h__
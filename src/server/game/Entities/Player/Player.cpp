@@ -143,6 +143,7 @@
 #include "WorldStatePackets.h"
 #include <boost/dynamic_bitset.hpp>
 #include <G3D/g3dmath.h>
+#include <atomic>
 #include <sstream>
 
 // corpse reclaim times
@@ -156,6 +157,11 @@ enum PlayerSpells
 
 static uint32 copseReclaimDelay[MAX_DEATH_COUNT] = { 30, 60, 120 };
 
+namespace
+{
+std::atomic<uint64> SkippedSaveStatementsCounter;
+}
+
 Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
 {
     m_objectType |= TYPEMASK_PLAYER;
@@ -191,7 +197,6 @@ Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
     m_team = TEAM_OTHER;
 
     m_nextSave = sWorld->getIntConfig(CONFIG_INTERVAL_SAVE);
-    m_customizationsChanged = false;
 
     memset(m_items, 0, sizeof(Item*)*PLAYER_SLOTS_COUNT);
 
@@ -228,7 +233,6 @@ Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
     PlayerTalkClass = std::make_unique<PlayerMenu>(GetSession());
     m_currentBuybackSlot = BUYBACK_SLOT_START;
 
-    m_DailyQuestChanged = false;
     m_lastDailyQuestTime = 0;
 
     m_MirrorTimer.fill(DISABLED_MIRROR_TIMER);
@@ -327,10 +331,6 @@ Player::Player(WorldSession* session) : Unit(true), m_sceneMgr(this)
 
     isDebugAreaTriggers = false;
 
-    m_WeeklyQuestChanged = false;
-    m_MonthlyQuestChanged = false;
-    m_SeasonalQuestChanged = false;
-
     SetPendingBind(0, 0);
 
     _activeCheats = CHEAT_NONE;
@@ -1097,7 +1097,10 @@ void Player::Update(uint32 p_time)
         for (InstanceTimeMap::iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end();)
         {
             if (itr->second < now)
+            {
                 _instanceResetTimes.erase(itr++);
+                SetSaveDataChanged(PlayerSaveData::InstanceTimes);
+            }
             else
                 ++itr;
         }
@@ -1512,6 +1515,7 @@ void Player::ProcessDelayedOperations()
         {
             CastSpell(this, m_bgData.mountSpell, true);
             m_bgData.mountSpell = 0;
+            SetSaveDataChanged(PlayerSaveData::BGData);
         }
     }
 
@@ -1522,6 +1526,7 @@ void Player::ProcessDelayedOperations()
             m_taxi.AddTaxiDestination(m_bgData.taxiPath[0]);
             m_taxi.AddTaxiDestination(m_bgData.taxiPath[1]);
             m_bgData.ClearTaxiPath();
+            SetSaveDataChanged(PlayerSaveData::BGData);
 
             ContinueTaxiFlight();
         }
@@ -1554,6 +1559,8 @@ void Player::RemoveFromWorld()
     // cleanup
     if (IsInWorld())
     {
+        _visibilityTracker.Invalidate();
+
         ///- Release charmed creatures, unsummon totems and remove pets/guardians
         StopCastingCharm();
         StopCastingBindSight();
@@ -16076,7 +16083,7 @@ void Player::RemoveRewardedQuest(uint32 questId, bool update /*= true*/)
         if (m_seasonalquests.find(eventId) != m_seasonalquests.end())
         {
             m_seasonalquests[eventId].erase(questId);
-            m_SeasonalQuestChanged = true;
+            SetSaveDataChanged(PlayerSaveData::SeasonalQuests);
         }
     }
 
@@ -18210,6 +18217,7 @@ bool Player::LoadFromDB(ObjectGuid guid, CharacterDatabaseQueryHolder const& hol
 
             // We are not in BG anymore
             m_bgData.bgInstanceID = 0;
+            SetSaveDataChanged(PlayerSaveData::BGData);
         }
     }
     // currently we do not support transport in bg
@@ -19760,7 +19768,7 @@ void Player::_LoadDailyQuestStatus(PreparedQueryResult result)
         while (result->NextRow());
     }
 
-    m_DailyQuestChanged = false;
+    m_changedSaveData.ClearChanged(PlayerSaveData::DailyQuests);
 }
 
 void Player::_LoadWeeklyQuestStatus(PreparedQueryResult result)
@@ -19786,7 +19794,7 @@ void Player::_LoadWeeklyQuestStatus(PreparedQueryResult result)
         while (result->NextRow());
     }
 
-    m_WeeklyQuestChanged = false;
+    m_changedSaveData.ClearChanged(PlayerSaveData::WeeklyQuests);
 }
 
 void Player::_LoadSeasonalQuestStatus(PreparedQueryResult result)
@@ -19814,7 +19822,7 @@ void Player::_LoadSeasonalQuestStatus(PreparedQueryResult result)
         while (result->NextRow());
     }
 
-    m_SeasonalQuestChanged = false;
+    m_changedSaveData.ClearChanged(PlayerSaveData::SeasonalQuests);
 }
 
 void Player::_LoadMonthlyQuestStatus(PreparedQueryResult result)
@@ -19840,7 +19848,7 @@ void Player::_LoadMonthlyQuestStatus(PreparedQueryResult result)
         while (result->NextRow());
     }
 
-    m_MonthlyQuestChanged = false;
+    m_changedSaveData.ClearChanged(PlayerSaveData::MonthlyQuests);
 }
 
 void Player::_LoadSpells(PreparedQueryResult result, PreparedQueryResult favoritesResult)
@@ -20117,7 +20125,10 @@ bool Player::CheckInstanceCount(uint32 instanceId) const
 void Player::AddInstanceEnterTime(uint32 instanceId, time_t enterTime)
 {
     if (_instanceResetTimes.find(instanceId) == _instanceResetTimes.end())
+    {
         _instanceResetTimes.insert(InstanceTimeMap::value_type(instanceId, enterTime + HOUR));
+        SetSaveDataChanged(PlayerSaveData::InstanceTimes);
+    }
 }
 
 WorldSafeLocsEntry const* Player::GetInstanceEntrance(uint32 targetMapId)
@@ -20783,13 +20794,23 @@ void Player::SaveCustomizations(CharacterDatabaseTransaction trans, ObjectGuid::
     SavePlayerCustomizations(trans, guid, customizations);
 }
 
+void PlayerSaveStatistics::AddSkippedStatements(std::size_t count)
+{
+    SkippedSaveStatementsCounter.fetch_add(count, std::memory_order_relaxed);
+}
+
+PlayerSaveStatistics PlayerSaveStatistics::Consume()
+{
+    PlayerSaveStatistics statistics;
+    statistics.SkippedStatements = SkippedSaveStatementsCounter.exchange(0, std::memory_order_relaxed);
+    return statistics;
+}
+
 void Player::_SaveCustomizations(CharacterDatabaseTransaction trans)
 {
-    if (!m_customizationsChanged)
+    if (!ConsumeSaveDataChanged(PlayerSaveData::Customizations))
         return;
 
-    m_customizationsChanged = false;
-
     SavePlayerCustomizations(trans, GetGUID().GetCounter(), Trinity::Containers::MakeIteratorPair(m_playerData->Customizations.begin(), m_playerData->Customizations.end()));
 }
 
@@ -21054,10 +21075,9 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
 
 void Player::_SaveVoidStorage(CharacterDatabaseTransaction trans)
 {
-    CharacterDatabasePreparedStatement* stmt = nullptr;
-
-    for (uint8 i = 0; i < VOID_STORAGE_MAX_SLOT; ++i)
+    PlayerSaveStatistics::AddSkippedStatements(_changedVoidStorageSlots.Save([&](uint8 i)
     {
+        CharacterDatabasePreparedStatement* stmt = nullptr;
         if (!_voidStorageItems[i]) // unused item
         {
             // DELETE FROM void_storage WHERE slot = ? AND playerGuid = ?
@@ -21085,14 +21105,14 @@ void Player::_SaveVoidStorage(CharacterDatabaseTransaction trans)
         }
 
         trans->Append(stmt);
-    }
+    }));
 }
 
 void Player::_SaveCUFProfiles(CharacterDatabaseTransaction trans)
 {
-    CharacterDatabasePreparedStatement* stmt;
-    for (uint8 i = 0; i < MAX_CUF_PROFILES; ++i)
+    PlayerSaveStatistics::AddSkippedStatements(_changedCUFProfiles.Save([&](uint8 i)
     {
+        CharacterDatabasePreparedStatement* stmt;
         if (!_CUFProfiles[i]) // unused profile
         {
             // DELETE FROM character_cuf_profiles WHERE guid = ? and id = ?
@@ -21121,7 +21141,7 @@ void Player::_SaveCUFProfiles(CharacterDatabaseTransaction trans)
         }
 
         trans->Append(stmt);
-    }
+    }));
 }
 
 void Player::_SaveMail(CharacterDatabaseTransaction trans)
@@ -21311,11 +21331,9 @@ void Player::_SaveQuestStatus(CharacterDatabaseTransaction trans)
 
 void Player::_SaveDailyQuestStatus(CharacterDatabaseTransaction trans)
 {
-    if (!m_DailyQuestChanged)
+    if (!ConsumeSaveDataChanged(PlayerSaveData::DailyQuests))
         return;
 
-    m_DailyQuestChanged = false;
-
     // save last daily quest time for all quests: we need only mostly reset time for reset check anyway
 
     // we don't need transactions here.
@@ -21347,7 +21365,7 @@ void Player::_SaveDailyQuestStatus(CharacterDatabaseTransaction trans)
 
 void Player::_SaveWeeklyQuestStatus(CharacterDatabaseTransaction trans)
 {
-    if (!m_WeeklyQuestChanged || m_weeklyquests.empty())
+    if (m_weeklyquests.empty() || !ConsumeSaveDataChanged(PlayerSaveData::WeeklyQuests))
         return;
 
     // we don't need transactions here.
@@ -21364,13 +21382,11 @@ void Player::_SaveWeeklyQuestStatus(CharacterDatabaseTransaction trans)
         stmt->setUInt32(1, questId);
         trans->Append(stmt);
     }
-
-    m_WeeklyQuestChanged = false;
 }
 
 void Player::_SaveSeasonalQuestStatus(CharacterDatabaseTransaction trans)
 {
-    if (!m_SeasonalQuestChanged)
+    if (!ConsumeSaveDataChanged(PlayerSaveData::SeasonalQuests))
         return;
 
     // we don't need transactions here.
@@ -21378,8 +21394,6 @@ void Player::_SaveSeasonalQuestStatus(CharacterDatabaseTransaction trans)
     stmt->setUInt64(0, GetGUID().GetCounter());
     trans->Append(stmt);
 
-    m_SeasonalQuestChanged = false;
-
     if (m_seasonalquests.empty())
         return;
 
@@ -21404,7 +21418,7 @@ void Player::_SaveSeasonalQuestStatus(CharacterDatabaseTransaction trans)
 
 void Player::_SaveMonthlyQuestStatus(CharacterDatabaseTransaction trans)
 {
-    if (!m_MonthlyQuestChanged || m_monthlyquests.empty())
+    if (m_monthlyquests.empty() || !ConsumeSaveDataChanged(PlayerSaveData::MonthlyQuests))
         return;
 
     // we don't need transactions here.
@@ -21421,8 +21435,6 @@ void Player::_SaveMonthlyQuestStatus(CharacterDatabaseTransaction trans)
         stmt->setUInt32(1, questId);
         trans->Append(stmt);
     }
-
-    m_MonthlyQuestChanged = false;
 }
 
 void Player::_SaveSkills(CharacterDatabaseTransaction trans)
@@ -24180,11 +24192,14 @@ void Player::SetBattlegroundEntryPoint()
 
     if (m_bgData.joinPos.m_mapId == MAPID_INVALID) // In error cases use homebind position
         m_bgData.joinPos.WorldRelocate(m_homebind);
+
+    SetSaveDataChanged(PlayerSaveData::BGData);
 }
 
 void Player::SetBGTeam(Team team)
 {
     m_bgData.bgTeam = team;
+    SetSaveDataChanged(PlayerSaveData::BGData);
     SetArenaFaction(uint8(team == ALLIANCE ? 1 : 0));
 }
 
@@ -24433,7 +24448,7 @@ void Player::UpdateVisibilityOf(Trinity::IteratorPair<WorldObject**> targets)
         return;
 
     UpdateData udata(GetMapId());
-    std::set<WorldObject*> newVisibleObjects;
+    std::vector<WorldObject*> newVisibleObjects;
 
     for (WorldObject* target : targets)
     {
@@ -24608,7 +24623,7 @@ void Player::SendInitialVisiblePackets(WorldObject* target) const
 }
 
 template<class T>
-void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<WorldObject*>& visibleNow)
+void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::vector<WorldObject*>& visibleNow)
 {
     if (HaveAtClient(target))
     {
@@ -24634,7 +24649,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<WorldObjec
         {
             target->BuildCreateUpdateBlockForPlayer(&data, this);
             m_clientGUIDs.insert(target->GetGUID());
-            visibleNow.insert(target);
+            visibleNow.push_back(target);
 
             #ifdef TRINITY_DEBUG
                 TC_LOG_DEBUG("maps", "Object {} is visible now for player {}. Distance = {}", target->GetGUID().ToString(), GetGUID().ToString(), GetDistance(target));
@@ -24643,14 +24658,14 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data, std::set<WorldObjec
     }
 }
 
-template void Player::UpdateVisibilityOf(Player*        target, UpdateData& data, std::set<WorldObject*>& visibleNow);
-template void Player::UpdateVisibilityOf(Creature*      target, UpdateData& data, std::set<WorldObject*>& visibleNow);
-template void Player::UpdateVisibilityOf(Corpse*        target, UpdateData& data, std::set<WorldObject*>& visibleNow);
-template void Player::UpdateVisibilityOf(GameObject*    target, UpdateData& data, std::set<WorldObject*>& visibleNow);
-template void Player::UpdateVisibilityOf(DynamicObject* target, UpdateData& data, std::set<WorldObject*>& visibleNow);
-template void Player::UpdateVisibilityOf(AreaTrigger*   target, UpdateData& data, std::set<WorldObject*>& visibleNow);
-template void Player::UpdateVisibilityOf(SceneObject*   target, UpdateData& data, std::set<WorldObject*>& visibleNow);
-template void Player::UpdateVisibilityOf(Conversation*  target, UpdateData& data, std::set<WorldObject*>& visibleNow);
+template void Player::UpdateVisibilityOf(Player*        target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
+template void Player::UpdateVisibilityOf(Creature*      target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
+template void Player::UpdateVisibilityOf(Corpse*        target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
+template void Player::UpdateVisibilityOf(GameObject*    target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
+template void Player::UpdateVisibilityOf(DynamicObject* target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
+template void Player::UpdateVisibilityOf(AreaTrigger*   target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
+template void Player::UpdateVisibilityOf(SceneObject*   target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
+template void Player::UpdateVisibilityOf(Conversation*  target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
 
 void Player::UpdateObjectVisibility(bool forced)
 {
@@ -24658,6 +24673,9 @@ void Player::UpdateObjectVisibility(bool forced)
     if (!IsInWorld())
         return;
 
+    // something else than our position changed, cells skipped by the previous visibility pass must be evaluated again
+    _visibilityTracker.Invalidate();
+
     if (!forced)
         AddToNotify(NOTIFY_VISIBILITY_CHANGED);
     else
@@ -24671,7 +24689,7 @@ void Player::UpdateVisibilityForPlayer()
 {
     // updates visibility of all objects around point of view for current player
     Trinity::VisibleNotifier notifier(*this);
-    Cell::VisitAllObjects(m_seer, notifier, GetSightRange());
+    Trinity::VisitObjectsForVisibility(*this, notifier, GetSightRange(), true);
     notifier.SendToSelf();   // send gathered data
 }
 
@@ -25393,13 +25411,13 @@ void Player::SetDailyQuestStatus(uint32 quest_id)
         {
             AddDynamicUpdateFieldValue(m_values.ModifyValue(&Player::m_activePlayerData).ModifyValue(&UF::ActivePlayerData::DailyQuestsCompleted)) = quest_id;
             m_lastDailyQuestTime = GameTime::GetGameTime();              // last daily quest time
-            m_DailyQuestChanged = true;
+            SetSaveDataChanged(PlayerSaveData::DailyQuests);
         }
         else
         {
             m_DFQuests.insert(quest_id);
             m_lastDailyQuestTime = GameTime::GetGameTime();
-            m_DailyQuestChanged = true;
+            SetSaveDataChanged(PlayerSaveData::DailyQuests);
         }
     }
 }
@@ -25412,7 +25430,7 @@ bool Player::IsDailyQuestDone(uint32 quest_id) const
 void Player::SetWeeklyQuestStatus(uint32 quest_id)
 {
     m_weeklyquests.insert(quest_id);
-    m_WeeklyQuestChanged = true;
+    SetSaveDataChanged(PlayerSaveData::WeeklyQuests);
 }
 
 void Player::SetSeasonalQuestStatus(uint32 quest_id)
@@ -25422,13 +25440,13 @@ void Player::SetSeasonalQuestStatus(uint32 quest_id)
         return;
 
     m_seasonalquests[quest->GetEventIdForQuest()][quest_id] = GameTime::GetGameTime();
-    m_SeasonalQuestChanged = true;
+    SetSaveDataChanged(PlayerSaveData::SeasonalQuests);
 }
 
 void Player::SetMonthlyQuestStatus(uint32 quest_id)
 {
     m_monthlyquests.insert(quest_id);
-    m_MonthlyQuestChanged = true;
+    SetSaveDataChanged(PlayerSaveData::MonthlyQuests);
 }
 
 void Player::DailyReset()
@@ -25466,7 +25484,7 @@ void Player::DailyReset()
     }
 
     // DB data deleted in caller
-    m_DailyQuestChanged = false;
+    m_changedSaveData.ClearChanged(PlayerSaveData::DailyQuests);
     m_lastDailyQuestTime = 0;
 
     if (_garrison)
@@ -25506,13 +25524,13 @@ void Player::ResetWeeklyQuestStatus()
 
     m_weeklyquests.clear();
     // DB data deleted in caller
-    m_WeeklyQuestChanged = false;
+    m_changedSaveData.ClearChanged(PlayerSaveData::WeeklyQuests);
 }
 
 void Player::ResetSeasonalQuestStatus(uint16 event_id, time_t eventStartTime)
 {
     // DB data deleted in caller
-    m_SeasonalQuestChanged = false;
+    m_changedSaveData.ClearChanged(PlayerSaveData::SeasonalQuests);
 
     auto eventItr = m_seasonalquests.find(event_id);
     if (eventItr == m_seasonalquests.end())
@@ -25548,7 +25566,7 @@ void Player::ResetMonthlyQuestStatus()
 
     m_monthlyquests.clear();
     // DB data deleted in caller
-    m_MonthlyQuestChanged = false;
+    m_changedSaveData.ClearChanged(PlayerSaveData::MonthlyQuests);
 }
 
 Battleground* Player::GetBattleground() const
@@ -25610,6 +25628,7 @@ void Player::SetBattlegroundId(uint32 val, BattlegroundTypeId bgTypeId, Battlegr
     m_bgData.bgInstanceID = val;
     m_bgData.bgTypeID = bgTypeId;
     m_bgData.queueId = queueId;
+    SetSaveDataChanged(PlayerSaveData::BGData);
 }
 
 uint32 Player::AddBattlegroundQueueId(BattlegroundQueueTypeId val)
@@ -28121,24 +28140,27 @@ void Player::_SaveEquipmentSets(CharacterDatabaseTransaction trans)
 
 void Player::_SaveBGData(CharacterDatabaseTransaction trans)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_BGDATA);
-    stmt->setUInt64(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-    /* guid, bgInstanceID, bgTeam, x, y, z, o, map, taxi[0], taxi[1], mountSpell */
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_BGDATA);
-    stmt->setUInt64(0, GetGUID().GetCounter());
-    stmt->setUInt32(1, m_bgData.bgInstanceID);
-    stmt->setUInt16(2, m_bgData.bgTeam);
-    stmt->setFloat (3, m_bgData.joinPos.GetPositionX());
-    stmt->setFloat (4, m_bgData.joinPos.GetPositionY());
-    stmt->setFloat (5, m_bgData.joinPos.GetPositionZ());
-    stmt->setFloat (6, m_bgData.joinPos.GetOrientation());
-    stmt->setUInt16(7, m_bgData.joinPos.GetMapId());
-    stmt->setUInt32(8, m_bgData.taxiPath[0]);
-    stmt->setUInt32(9, m_bgData.taxiPath[1]);
-    stmt->setUInt32(10, m_bgData.mountSpell);
-    stmt->setUInt64(11, m_bgData.queueId.GetPacked());
-    trans->Append(stmt);
+    PlayerSaveStatistics::AddSkippedStatements(m_changedSaveData.Save(PlayerSaveData::BGData, 2, [&]
+    {
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_BGDATA);
+        stmt->setUInt64(0, GetGUID().GetCounter());
+        trans->Append(stmt);
+        /* guid, bgInstanceID, bgTeam, x, y, z, o, map, taxi[0], taxi[1], mountSpell */
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_BGDATA);
+        stmt->setUInt64(0, GetGUID().GetCounter());
+        stmt->setUInt32(1, m_bgData.bgInstanceID);
+        stmt->setUInt16(2, m_bgData.bgTeam);
+        stmt->setFloat (3, m_bgData.joinPos.GetPositionX());
+        stmt->setFloat (4, m_bgData.joinPos.GetPositionY());
+        stmt->setFloat (5, m_bgData.joinPos.GetPositionZ());
+        stmt->setFloat (6, m_bgData.joinPos.GetOrientation());
+        stmt->setUInt16(7, m_bgData.joinPos.GetMapId());
+        stmt->setUInt32(8, m_bgData.taxiPath[0]);
+        stmt->setUInt32(9, m_bgData.taxiPath[1]);
+        stmt->setUInt32(10, m_bgData.mountSpell);
+        stmt->setUInt64(11, m_bgData.queueId.GetPacked());
+        trans->Append(stmt);
+    }));
 }
 
 void Player::DeleteEquipmentSet(uint64 id)
@@ -29849,18 +29871,21 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
     if (_instanceResetTimes.empty())
         return;
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
-    stmt->setUInt32(0, GetSession()->GetAccountId());
-    trans->Append(stmt);
-
-    for (InstanceTimeMap::const_iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end(); ++itr)
+    PlayerSaveStatistics::AddSkippedStatements(m_changedSaveData.Save(PlayerSaveData::InstanceTimes, 1 + _instanceResetTimes.size(), [&]
     {
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES);
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
         stmt->setUInt32(0, GetSession()->GetAccountId());
-        stmt->setUInt32(1, itr->first);
-        stmt->setInt64(2, itr->second);
         trans->Append(stmt);
-    }
+
+        for (InstanceTimeMap::const_iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end(); ++itr)
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES);
+            stmt->setUInt32(0, GetSession()->GetAccountId());
+            stmt->setUInt32(1, itr->first);
+            stmt->setInt64(2, itr->second);
+            trans->Append(stmt);
+        }
+    }));
 }
 
 bool Player::IsInWhisperWhiteList(ObjectGuid guid)
@@ -29903,6 +29928,7 @@ uint8 Player::AddVoidStorageItem(VoidStorageItem&& item)
     }
 
     _voidStorageItems[slot] = new VoidStorageItem(std::move(item));
+    _changedVoidStorageSlots.SetChanged(slot);
     return slot;
 }
 
@@ -29916,6 +29942,7 @@ void Player::DeleteVoidStorageItem(uint8 slot)
 
     delete _voidStorageItems[slot];
     _voidStorageItems[slot] = nullptr;
+    _changedVoidStorageSlots.SetChanged(slot);
 }
 
 bool Player::SwapVoidStorageItem(uint8 oldSlot, uint8 newSlot)
@@ -29924,6 +29951,8 @@ bool Player::SwapVoidStorageItem(uint8 oldSlot, uint8 newSlot)
         return false;
 
     std::swap(_voidStorageItems[newSlot], _voidStorageItems[oldSlot]);
+    _changedVoidStorageSlots.SetChanged(newSlot);
+    _changedVoidStorageSlots.SetChanged(oldSlot);
     return true;
 }
 
@@ -30,9 +30,11 @@
 #include "ItemEnchantmentMgr.h"
 #include "MapReference.h"
 #include "PetDefines.h"
+#include "PlayerSaveSlots.h"
 #include "PlayerTaxi.h"
 #include "QuestDef.h"
 #include "SceneMgr.h"
+#include "VisibilityTracker.h"
 #include <variant>
 
 struct AccessRequirement;
@@ -1058,6 +1060,16 @@ enum class AvgItemLevelCategory : uint32
 
 class Player;
 
+struct TC_GAME_API PlayerSaveStatistics
+{
+    uint64 SkippedStatements = 0;   ///< statements not written by SaveToDB because their data did not change
+
+    static void AddSkippedStatements(std::size_t count);
+
+    // Returns statistics collected since previous call
+    static PlayerSaveStatistics Consume();
+};
+
 /// Holder for Battleground data
 struct BGData
 {
@@ -1198,6 +1210,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
+        void UpdatePackedGridPosition() override { UpdateGridPosition(); }
 
         void SetObjectScale(float scale) override;
 
@@ -1782,8 +1795,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void AddTimedQuest(uint32 questId) { m_timedquests.insert(questId); }
         void RemoveTimedQuest(uint32 questId) { m_timedquests.erase(questId); }
 
-        void SaveCUFProfile(uint8 id, std::nullptr_t) { _CUFProfiles[id] = nullptr; } ///> Empties a CUF profile at position 0-4
-        void SaveCUFProfile(uint8 id, std::unique_ptr<CUFProfile> profile) { _CUFProfiles[id] = std::move(profile); } ///> Replaces a CUF profile at position 0-4
+        void SaveCUFProfile(uint8 id, std::nullptr_t) { _CUFProfiles[id] = nullptr; _changedCUFProfiles.SetChanged(id); } ///> Empties a CUF profile at position 0-4
+        void SaveCUFProfile(uint8 id, std::unique_ptr<CUFProfile> profile) { _CUFProfiles[id] = std::move(profile); _changedCUFProfiles.SetChanged(id); } ///> Replaces a CUF profile at position 0-4
         CUFProfile* GetCUFProfile(uint8 id) const { return _CUFProfiles[id].get(); } ///> Retrieves a CUF profile at position 0-4
         uint8 GetCUFProfilesCount() const
         {
@@ -2637,12 +2650,13 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void OnPhaseChange() override;
         void UpdateObjectVisibility(bool forced = true) override;
         void UpdateVisibilityForPlayer();
+        Trinity::VisibilityTracker& GetVisibilityTracker() { return _visibilityTracker; }
         void UpdateVisibilityOf(WorldObject* target);
         void UpdateVisibilityOf(Trinity::IteratorPair<WorldObject**> targets);
         void UpdateTriggerVisibility();
 
         template<class T>
-        void UpdateVisibilityOf(T* target, UpdateData& data, std::set<WorldObject*>& visibleNow);
+        void UpdateVisibilityOf(T* target, UpdateData& data, std::vector<WorldObject*>& visibleNow);
 
         std::array<uint8, MAX_MOVE_TYPE> m_forced_speed_changes;
         uint8 m_movementForceModMagnitudeChanges;
@@ -2881,7 +2895,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void SetCustomizations(Trinity::IteratorPair<Iter> customizations, bool markChanged = true)
         {
             if (markChanged)
-                m_customizationsChanged = true;
+                SetSaveDataChanged(PlayerSaveData::Customizations);
 
             ClearDynamicUpdateFieldValues(m_values.ModifyValue(&Player::m_playerData).ModifyValue(&UF::PlayerData::Customizations));
             for (auto&& customization : customizations)
@@ -3120,6 +3134,9 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         void _SaveCUFProfiles(CharacterDatabaseTransaction trans);
         void _SavePlayerData(CharacterDatabaseTransaction trans);
 
+        void SetSaveDataChanged(PlayerSaveData data) { m_changedSaveData.SetChanged(data); }
+        bool ConsumeSaveDataChanged(PlayerSaveData data) { return m_changedSaveData.Consume(data); }
+
         /*********************************************************/
         /***              ENVIRONMENTAL SYSTEM                 ***/
         /*********************************************************/
@@ -3138,7 +3155,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
 
         Team m_team;
         uint32 m_nextSave;
-        bool m_customizationsChanged;
+        PlayerChangedSaveData m_changedSaveData;
         std::array<ChatFloodThrottle, ChatFloodThrottle::MAX> m_chatFloodData;
         Difficulty m_dungeonDifficulty;
         Difficulty m_raidDifficulty;
@@ -3152,6 +3169,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         PlayerCurrenciesMap _currencyStorage;
 
         VoidStorageItem* _voidStorageItems[VOID_STORAGE_MAX_SLOT];
+        PlayerSaveSlots<VOID_STORAGE_MAX_SLOT> _changedVoidStorageSlots;
 
         std::vector<Item*> m_itemUpdateQueue;
         bool m_itemUpdateQueueBlocked;
@@ -3212,10 +3230,6 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
 
         TradeData* m_trade;
 
-        bool   m_DailyQuestChanged;
-        bool   m_WeeklyQuestChanged;
-        bool   m_MonthlyQuestChanged;
-        bool   m_SeasonalQuestChanged;
         time_t m_lastDailyQuestTime;
 
         uint32 m_hostileReferenceCheckTimer;
@@ -3268,6 +3282,7 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         uint8 m_fishingSteps;
 
         std::array<std::unique_ptr<CUFProfile>, MAX_CUF_PROFILES> _CUFProfiles;
+        PlayerSaveSlots<MAX_CUF_PROFILES> _changedCUFProfiles;
 
     private:
         // internal common parts for CanStore/StoreItem functions
@@ -3356,6 +3371,8 @@ class TC_GAME_API Player final : public Unit, public GridObject<Player>
         bool _usePvpItemLevels;
         ObjectGuid _areaSpiritHealerGUID;
 
+        Trinity::VisibilityTracker _visibilityTracker;
+
         // Spell cast request handling
     public:
         // Queues up a spell cast request that has been received via packet and processes it whenever possible.
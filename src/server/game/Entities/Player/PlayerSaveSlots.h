@@ -0,0 +1,102 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_PLAYER_SAVE_SLOTS_H
+#define TRINITYCORE_PLAYER_SAVE_SLOTS_H
+
+#include "Define.h"
+#include "EnumFlag.h"
+#include <bitset>
+
+/// Player data that is saved as a whole and only written by SaveToDB after it changed
+/// Talents, glyphs, stats and auras are still rewritten on every save - talents and glyphs are modified
+/// through the non-const GetTalentMap/GetPvpTalentMap/GetGlyphs accessors, stats and aura durations change constantly
+enum class PlayerSaveData : uint16
+{
+    None                = 0x000,
+    Customizations      = 0x001,
+    BGData              = 0x002,
+    DailyQuests         = 0x004,
+    WeeklyQuests        = 0x008,
+    SeasonalQuests      = 0x010,
+    MonthlyQuests       = 0x020,
+    InstanceTimes       = 0x040
+};
+
+DEFINE_ENUM_FLAG(PlayerSaveData);
+
+/// Player data saved as a whole that changed since it was last saved
+class PlayerChangedSaveData
+{
+public:
+    void SetChanged(PlayerSaveData data) { _changed |= data; }
+    void ClearChanged(PlayerSaveData data) { _changed &= ~data; }
+
+    /// Returns true if data changed since last call and marks it as saved
+    bool Consume(PlayerSaveData data)
+    {
+        bool changed = (_changed & data) != PlayerSaveData::None;
+        _changed &= ~data;
+        return changed;
+    }
+
+    /// Calls save if data changed and marks it as saved
+    /// Returns statementCount when save was skipped, 0 otherwise
+    template<typename SaveData>
+    std::size_t Save(PlayerSaveData data, std::size_t statementCount, SaveData&& save)
+    {
+        if (!Consume(data))
+            return statementCount;
+
+        save();
+        return 0;
+    }
+
+private:
+    PlayerSaveData _changed = PlayerSaveData::None;
+};
+
+/// Rows of a fixed size player table that changed since they were last saved
+template<std::size_t SlotCount>
+class PlayerSaveSlots
+{
+public:
+    void SetChanged(std::size_t slot) { _changed.set(slot); }
+    bool IsChanged(std::size_t slot) const { return _changed.test(slot); }
+
+    /// Calls saveSlot for every changed slot and marks all slots as saved
+    /// Returns number of unchanged slots that were not written
+    template<typename SaveSlot>
+    std::size_t Save(SaveSlot&& saveSlot)
+    {
+        if (_changed.none())
+            return SlotCount;
+
+        for (std::size_t slot = 0; slot < SlotCount; ++slot)
+            if (_changed.test(slot))
+                saveSlot(slot);
+
+        std::size_t skipped = SlotCount - _changed.count();
+        _changed.reset();
+        return skipped;
+    }
+
+private:
+    std::bitset<SlotCount> _changed;
+};
+
+#endif // TRINITYCORE_PLAYER_SAVE_SLOTS_H
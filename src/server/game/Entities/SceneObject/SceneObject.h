@@ -57,6 +57,7 @@ public:
 
     void AddToWorld() override;
     void RemoveFromWorld() override;
+    void UpdatePackedGridPosition() override { UpdateGridPosition(); }
 
     void Update(uint32 diff) override;
     void Remove();
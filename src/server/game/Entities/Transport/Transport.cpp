@@ -716,9 +716,10 @@ void Transport::BuildUpdate(UpdateDataMapType& data_map)
     if (players.isEmpty())
         return;
 
+    ValuesUpdateBlockCache& blockCache = ValuesUpdateBlockCache::AcquireForCurrentThread();
     for (MapReference const& playerReference : players)
         if (playerReference.GetSource()->InSamePhase(this))
-            BuildFieldsUpdate(playerReference.GetSource(), data_map);
+            BuildFieldsUpdate(playerReference.GetSource(), data_map, blockCache);
 
     ClearUpdateMask(true);
 }
@@ -27,7 +27,6 @@
 #include "Pet.h"
 #include "Player.h"
 #include "Transport.h"
-#include <mutex>
 
 template<class T>
 void HashMapHolder<T>::Insert(T* o)
@@ -35,26 +34,19 @@ void HashMapHolder<T>::Insert(T* o)
     static_assert(std::is_same<Player, T>::value,
         "Only Player can be registered in global HashMapHolder");
 
-    std::unique_lock<std::shared_mutex> lock(*GetLock());
-
-    GetContainer()[o->GetGUID()] = o;
+    GetContainer().Insert(o->GetGUID(), o);
 }
 
 template<class T>
 void HashMapHolder<T>::Remove(T* o)
 {
-    std::unique_lock<std::shared_mutex> lock(*GetLock());
-
-    GetContainer().erase(o->GetGUID());
+    GetContainer().Remove(o->GetGUID());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
-
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    return GetContainer().Find(guid);
 }
 
 template<class T>
@@ -64,28 +56,29 @@ auto HashMapHolder<T>::GetContainer() -> MapType&
     return _objectMap;
 }
 
-template<class T>
-std::shared_mutex* HashMapHolder<T>::GetLock()
-{
-    static std::shared_mutex _lock;
-    return &_lock;
-}
-
 template class TC_GAME_API HashMapHolder<Player>;
 
 namespace PlayerNameMapHolder
 {
-    typedef std::unordered_map<std::string, Player*> MapType;
+    // keyed by normalized name, lookups are case insensitive
+    typedef Trinity::Containers::ShardedHashMap<std::string, Player*> MapType;
     static MapType PlayerNameMap;
 
+    std::string GetKey(Player const* p)
+    {
+        std::string charName(p->GetName());
+        normalizePlayerName(charName);
+        return charName;
+    }
+
     void Insert(Player* p)
     {
-        PlayerNameMap[p->GetName()] = p;
+        PlayerNameMap.Insert(GetKey(p), p);
     }
 
     void Remove(Player* p)
     {
-        PlayerNameMap.erase(p->GetName());
+        PlayerNameMap.Remove(GetKey(p));
     }
 
     Player* Find(std::string_view name)
@@ -94,8 +87,7 @@ namespace PlayerNameMapHolder
         if (!normalizePlayerName(charName))
             return nullptr;
 
-        auto itr = PlayerNameMap.find(charName);
-        return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
+        return PlayerNameMap.Find(charName);
     }
 } // namespace PlayerNameMapHolder
 
@@ -283,18 +275,12 @@ Player* ObjectAccessor::FindConnectedPlayerByName(std::string_view name)
     return PlayerNameMapHolder::Find(name);
 }
 
-HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
-{
-    return HashMapHolder<Player>::GetContainer();
-}
-
 void ObjectAccessor::SaveAllPlayers()
 {
-    std::shared_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
-
-    HashMapHolder<Player>::MapType const& m = GetPlayers();
-    for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
-        itr->second->SaveToDB();
+    DoForAllPlayers([](Player* player)
+    {
+        player->SaveToDB();
+    });
 }
 
 template<>
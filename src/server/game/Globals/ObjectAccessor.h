@@ -19,8 +19,7 @@
 #define TRINITY_OBJECTACCESSOR_H
 
 #include "ObjectGuid.h"
-#include <shared_mutex>
-#include <unordered_map>
+#include "ShardedHashMap.h"
 
 class AreaTrigger;
 class Conversation;
@@ -45,7 +44,7 @@ class TC_GAME_API HashMapHolder
 
 public:
 
-    typedef std::unordered_map<ObjectGuid, T*> MapType;
+    typedef Trinity::Containers::ShardedHashMap<ObjectGuid, T*> MapType;
 
     static void Insert(T* o);
 
@@ -54,8 +53,6 @@ public:
     static T* Find(ObjectGuid guid);
 
     static MapType& GetContainer();
-
-    static std::shared_mutex* GetLock();
 };
 
 namespace ObjectAccessor
@@ -87,8 +84,12 @@ namespace ObjectAccessor
     TC_GAME_API Player* FindConnectedPlayer(ObjectGuid const&);
     TC_GAME_API Player* FindConnectedPlayerByName(std::string_view name);
 
-    // when using this, you must use the hashmapholder's lock
-    TC_GAME_API HashMapHolder<Player>::MapType const& GetPlayers();
+    // worker is called with every connected player, players added or removed meanwhile may or may not be visited
+    template<class Worker>
+    void DoForAllPlayers(Worker&& worker)
+    {
+        HashMapHolder<Player>::GetContainer().DoForAll([&worker](ObjectGuid const& /*guid*/, Player* player) { worker(player); });
+    }
 
     template<class T>
     void AddObject(T* object)
@@ -64,6 +64,7 @@
 #include "SpellInfo.h"
 #include "SpellMgr.h"
 #include "SpellScript.h"
+#include "StartupSnapshot.h"
 #include "StringConvert.h"
 #include "TemporarySummon.h"
 #include "TerrainMgr.h"
@@ -2717,6 +2718,471 @@ void ObjectMgr::LoadGameObjects()
     TC_LOG_INFO("server.loading", ">> Loaded {} gameobjects in {} ms", _gameObjectDataStore.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
+void ObjectMgr::WriteCreatureTemplateSnapshot(ByteBuffer& data) const
+{
+    // gossip menus and query data are added after templates are loaded, they are not part of the snapshot
+    data << uint32(_creatureTemplateStore.size());
+    for (auto const& [entry, creatureTemplate] : _creatureTemplateStore)
+    {
+        data << uint32(entry);
+        for (uint32 killCredit : creatureTemplate.KillCredit)
+            data << uint32(killCredit);
+
+        data << uint32(creatureTemplate.Models.size());
+        for (CreatureModel const& model : creatureTemplate.Models)
+        {
+            data << uint32(model.CreatureDisplayID);
+            data << float(model.DisplayScale);
+            data << float(model.Probability);
+        }
+
+        data << creatureTemplate.Name;
+        data << creatureTemplate.FemaleName;
+        data << creatureTemplate.SubName;
+        data << creatureTemplate.TitleAlt;
+        data << creatureTemplate.IconName;
+
+        data << uint32(creatureTemplate.difficultyStore.size());
+        for (auto const& [difficulty, creatureDifficulty] : creatureTemplate.difficultyStore)
+        {
+            data << uint8(difficulty);
+            data << int16(creatureDifficulty.DeltaLevelMin);
+            data << int16(creatureDifficulty.DeltaLevelMax);
+            data << int32(creatureDifficulty.ContentTuningID);
+            data << int32(creatureDifficulty.HealthScalingExpansion);
+            data << float(creatureDifficulty.HealthModifier);
+            data << float(creatureDifficulty.ManaModifier);
+            data << float(creatureDifficulty.ArmorModifier);
+            data << float(creatureDifficulty.DamageModifier);
+            data << int32(creatureDifficulty.CreatureDifficultyID);
+            data << uint32(creatureDifficulty.TypeFlags);
+            data << uint32(creatureDifficulty.TypeFlags2);
+            data << uint32(creatureDifficulty.LootID);
+            data << uint32(creatureDifficulty.PickPocketLootID);
+            data << uint32(creatureDifficulty.SkinLootID);
+            data << uint32(creatureDifficulty.GoldMin);
+            data << uint32(creatureDifficulty.GoldMax);
+            data << uint32(creatureDifficulty.StaticFlags.GetFlags().AsUnderlyingType());
+            data << uint32(creatureDifficulty.StaticFlags.GetFlags2().AsUnderlyingType());
+            data << uint32(creatureDifficulty.StaticFlags.GetFlags3().AsUnderlyingType());
+            data << uint32(creatureDifficulty.StaticFlags.GetFlags4().AsUnderlyingType());
+            data << uint32(creatureDifficulty.StaticFlags.GetFlags5().AsUnderlyingType());
+            data << uint32(creatureDifficulty.StaticFlags.GetFlags6().AsUnderlyingType());
+            data << uint32(creatureDifficulty.StaticFlags.GetFlags7().AsUnderlyingType());
+            data << uint32(creatureDifficulty.StaticFlags.GetFlags8().AsUnderlyingType());
+        }
+
+        data << uint32(creatureTemplate.RequiredExpansion);
+        data << uint32(creatureTemplate.VignetteID);
+        data << uint32(creatureTemplate.faction);
+        data << uint64(creatureTemplate.npcflag);
+        data << float(creatureTemplate.speed_walk);
+        data << float(creatureTemplate.speed_run);
+        data << float(creatureTemplate.scale);
+        data << uint32(creatureTemplate.Classification);
+        data << uint32(creatureTemplate.dmgschool);
+        data << uint32(creatureTemplate.BaseAttackTime);
+        data << uint32(creatureTemplate.RangeAttackTime);
+        data << float(creatureTemplate.BaseVariance);
+        data << float(creatureTemplate.RangeVariance);
+        data << uint32(creatureTemplate.unit_class);
+        data << uint32(creatureTemplate.unit_flags);
+        data << uint32(creatureTemplate.unit_flags2);
+        data << uint32(creatureTemplate.unit_flags3);
+        data << int32(creatureTemplate.family);
+        data << uint32(creatureTemplate.trainer_class);
+        data << uint32(creatureTemplate.type);
+        for (int32 resistance : creatureTemplate.resistance)
+            data << int32(resistance);
+        for (uint32 spell : creatureTemplate.spells)
+            data << uint32(spell);
+        data << uint32(creatureTemplate.VehicleId);
+        data << creatureTemplate.AIName;
+        data << uint32(creatureTemplate.MovementType);
+        data << uint8(creatureTemplate.Movement.HoverInitiallyEnabled);
+        data << uint8(creatureTemplate.Movement.Chase);
+        data << uint8(creatureTemplate.Movement.Random);
+        data << uint32(creatureTemplate.Movement.InteractionPauseTimer);
+        data << float(creatureTemplate.ModExperience);
+        data << uint8(creatureTemplate.RacialLeader);
+        data << uint32(creatureTemplate.movementId);
+        data << int32(creatureTemplate.WidgetSetID);
+        data << int32(creatureTemplate.WidgetSetUnitConditionID);
+        data << uint8(creatureTemplate.RegenHealth);
+        data << int32(creatureTemplate.CreatureImmunitiesId);
+        data << uint32(creatureTemplate.flags_extra);
+        data << GetScriptName(creatureTemplate.ScriptID);   // script ids depend on loading order
+        data << creatureTemplate.StringId;
+    }
+}
+
+void ObjectMgr::ReadCreatureTemplateSnapshot(StartupSnapshotReader& data)
+{
+    CreatureTemplateContainer creatureTemplateStore;
+
+    uint32 creatureTemplateCount = data.ReadCount();
+    creatureTemplateStore.reserve(creatureTemplateCount);
+    for (uint32 i = 0; i < creatureTemplateCount; ++i)
+    {
+        uint32 entry = data.read<uint32>();
+        CreatureTemplate& creatureTemplate = creatureTemplateStore[entry];
+        creatureTemplate.Entry = entry;
+        for (uint32& killCredit : creatureTemplate.KillCredit)
+            killCredit = data.read<uint32>();
+
+        creatureTemplate.Models.resize(data.ReadCount());
+        for (CreatureModel& model : creatureTemplate.Models)
+        {
+            model.CreatureDisplayID = data.read<uint32>();
+            model.DisplayScale = data.read<float>();
+            model.Probability = data.read<float>();
+        }
+
+        creatureTemplate.Name = data.ReadCString();
+        creatureTemplate.FemaleName = data.ReadCString();
+        creatureTemplate.SubName = data.ReadCString();
+        creatureTemplate.TitleAlt = data.ReadCString();
+        creatureTemplate.IconName = data.ReadCString();
+
+        uint32 difficultyCount = data.ReadCount();
+        for (uint32 j = 0; j < difficultyCount; ++j)
+        {
+            CreatureDifficulty& creatureDifficulty = creatureTemplate.difficultyStore[Difficulty(data.read<uint8>())];
+            creatureDifficulty.DeltaLevelMin = data.read<int16>();
+            creatureDifficulty.DeltaLevelMax = data.read<int16>();
+            creatureDifficulty.ContentTuningID = data.read<int32>();
+            creatureDifficulty.HealthScalingExpansion = data.read<int32>();
+            creatureDifficulty.HealthModifier = data.read<float>();
+            creatureDifficulty.ManaModifier = data.read<float>();
+            creatureDifficulty.ArmorModifier = data.read<float>();
+            creatureDifficulty.DamageModifier = data.read<float>();
+            creatureDifficulty.CreatureDifficultyID = data.read<int32>();
+            creatureDifficulty.TypeFlags = data.read<uint32>();
+            creatureDifficulty.TypeFlags2 = data.read<uint32>();
+            creatureDifficulty.LootID = data.read<uint32>();
+            creatureDifficulty.PickPocketLootID = data.read<uint32>();
+            creatureDifficulty.SkinLootID = data.read<uint32>();
+            creatureDifficulty.GoldMin = data.read<uint32>();
+            creatureDifficulty.GoldMax = data.read<uint32>();
+            CreatureStaticFlags flags = CreatureStaticFlags(data.read<uint32>());
+            CreatureStaticFlags2 flags2 = CreatureStaticFlags2(data.read<uint32>());
+            CreatureStaticFlags3 flags3 = CreatureStaticFlags3(data.read<uint32>());
+            CreatureStaticFlags4 flags4 = CreatureStaticFlags4(data.read<uint32>());
+            CreatureStaticFlags5 flags5 = CreatureStaticFlags5(data.read<uint32>());
+            CreatureStaticFlags6 flags6 = CreatureStaticFlags6(data.read<uint32>());
+            CreatureStaticFlags7 flags7 = CreatureStaticFlags7(data.read<uint32>());
+            CreatureStaticFlags8 flags8 = CreatureStaticFlags8(data.read<uint32>());
+            creatureDifficulty.StaticFlags = CreatureStaticFlagsHolder(flags, flags2, flags3, flags4, flags5, flags6, flags7, flags8);
+        }
+
+        creatureTemplate.RequiredExpansion = data.read<uint32>();
+        creatureTemplate.VignetteID = data.read<uint32>();
+        creatureTemplate.faction = data.read<uint32>();
+        creatureTemplate.npcflag = data.read<uint64>();
+        creatureTemplate.speed_walk = data.read<float>();
+        creatureTemplate.speed_run = data.read<float>();
+        creatureTemplate.scale = data.read<float>();
+        creatureTemplate.Classification = CreatureClassifications(data.read<uint32>());
+        creatureTemplate.dmgschool = data.read<uint32>();
+        creatureTemplate.BaseAttackTime = data.read<uint32>();
+        creatureTemplate.RangeAttackTime = data.read<uint32>();
+        creatureTemplate.BaseVariance = data.read<float>();
+        creatureTemplate.RangeVariance = data.read<float>();
+        creatureTemplate.unit_class = data.read<uint32>();
+        creatureTemplate.unit_flags = data.read<uint32>();
+        creatureTemplate.unit_flags2 = data.read<uint32>();
+        creatureTemplate.unit_flags3 = data.read<uint32>();
+        creatureTemplate.family = CreatureFamily(data.read<int32>());
+        creatureTemplate.trainer_class = data.read<uint32>();
+        creatureTemplate.type = data.read<uint32>();
+        for (int32& resistance : creatureTemplate.resistance)
+            resistance = data.read<int32>();
+        for (uint32& spell : creatureTemplate.spells)
+            spell = data.read<uint32>();
+        creatureTemplate.VehicleId = data.read<uint32>();
+        creatureTemplate.AIName = data.ReadCString();
+        creatureTemplate.MovementType = data.read<uint32>();
+        creatureTemplate.Movement.HoverInitiallyEnabled = data.read<uint8>() != 0;
+        creatureTemplate.Movement.Chase = CreatureChaseMovementType(data.read<uint8>());
+        creatureTemplate.Movement.Random = CreatureRandomMovementType(data.read<uint8>());
+        creatureTemplate.Movement.InteractionPauseTimer = data.read<uint32>();
+        creatureTemplate.ModExperience = data.read<float>();
+        creatureTemplate.RacialLeader = data.read<uint8>() != 0;
+        creatureTemplate.movementId = data.read<uint32>();
+        creatureTemplate.WidgetSetID = data.read<int32>();
+        creatureTemplate.WidgetSetUnitConditionID = data.read<int32>();
+        creatureTemplate.RegenHealth = data.read<uint8>() != 0;
+        creatureTemplate.CreatureImmunitiesId = data.read<int32>();
+        creatureTemplate.flags_extra = data.read<uint32>();
+        creatureTemplate.ScriptID = GetScriptId(std::string(data.ReadCString()));
+        creatureTemplate.StringId = data.ReadCString();
+    }
+
+    data.ReadEnd();
+    _creatureTemplateStore = std::move(creatureTemplateStore);
+}
+
+void ObjectMgr::WriteGameObjectTemplateSnapshot(ByteBuffer& data) const
+{
+    data << uint32(_gameObjectTemplateStore.size());
+    for (auto const& [entry, got] : _gameObjectTemplateStore)
+    {
+        data << uint32(entry);
+        data << uint32(got.type);
+        data << uint32(got.displayId);
+        data << got.name;
+        data << got.IconName;
+        data << got.castBarCaption;
+        data << got.unk1;
+        data << float(got.size);
+        data << int32(got.ContentTuningId);
+        for (uint32 value : got.raw.data)
+            data << uint32(value);
+        data << got.AIName;
+        data << GetScriptName(got.ScriptId);
+        data << got.StringId;
+    }
+}
+
+void ObjectMgr::ReadGameObjectTemplateSnapshot(StartupSnapshotReader& data)
+{
+    GameObjectTemplateContainer gameObjectTemplateStore;
+
+    uint32 gameObjectTemplateCount = data.ReadCount();
+    gameObjectTemplateStore.reserve(gameObjectTemplateCount);
+    for (uint32 i = 0; i < gameObjectTemplateCount; ++i)
+    {
+        uint32 entry = data.read<uint32>();
+        GameObjectTemplate& got = gameObjectTemplateStore[entry];
+        got.entry = entry;
+        got.type = data.read<uint32>();
+        got.displayId = data.read<uint32>();
+        got.name = data.ReadCString();
+        got.IconName = data.ReadCString();
+        got.castBarCaption = data.ReadCString();
+        got.unk1 = data.ReadCString();
+        got.size = data.read<float>();
+        got.ContentTuningId = data.read<int32>();
+        for (uint32& value : got.raw.data)
+            value = data.read<uint32>();
+        got.AIName = data.ReadCString();
+        got.ScriptId = GetScriptId(std::string(data.ReadCString()));
+        got.StringId = data.ReadCString();
+    }
+
+    data.ReadEnd();
+    _gameObjectTemplateStore = std::move(gameObjectTemplateStore);
+
+    // same maps as collected by LoadGameObjectTemplate
+    _transportMaps.clear();
+    for (auto const& [entry, got] : _gameObjectTemplateStore)
+    {
+        switch (got.type)
+        {
+            case GAMEOBJECT_TYPE_MAP_OBJ_TRANSPORT:
+                if (uint32 transportMap = got.moTransport.SpawnMap)
+                    _transportMaps.insert(transportMap);
+                break;
+            case GAMEOBJECT_TYPE_GARRISON_BUILDING:
+                if (uint32 transportMap = got.garrisonBuilding.SpawnMap)
+                    _transportMaps.insert(transportMap);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+template<CellGuidSet CellObjectGuids::*guids>
+bool ObjectMgr::IsSpawnDataInGrid(SpawnData const* data) const
+{
+    // spawns are added for all their difficulties at once
+    if (data->spawnDifficulties.empty())
+        return false;
+
+    CellObjectGuidsMap const* cells = PhasingHandler::IsPersonalPhase(data->phaseId)
+        ? Trinity::Containers::MapGetValuePtr(_mapPersonalObjectGuidsStore, { data->mapId, data->spawnDifficulties.front(), data->phaseId })
+        : Trinity::Containers::MapGetValuePtr(_mapObjectGuidsStore, { data->mapId, data->spawnDifficulties.front() });
+    if (!cells)
+        return false;
+
+    CellObjectGuids const* cell = Trinity::Containers::MapGetValuePtr(*cells, Trinity::ComputeCellCoord(data->spawnPoint.GetPositionX(), data->spawnPoint.GetPositionY()).GetId());
+    return cell && (cell->*guids).contains(data->spawnId);
+}
+
+void ObjectMgr::WriteSpawnDataSnapshot(ByteBuffer& data, SpawnData const& spawn) const
+{
+    data << uint64(spawn.spawnId);
+    data << uint32(spawn.id);
+    data << uint32(spawn.mapId);
+    data << float(spawn.spawnPoint.GetPositionX());
+    data << float(spawn.spawnPoint.GetPositionY());
+    data << float(spawn.spawnPoint.GetPositionZ());
+    data << float(spawn.spawnPoint.GetOrientation());
+    data << uint8(spawn.phaseUseFlags);
+    data << uint32(spawn.phaseId);
+    data << uint32(spawn.phaseGroup);
+    data << int32(spawn.terrainSwapMap);
+    data << uint32(spawn.poolId);
+    data << int32(spawn.spawntimesecs);
+    data << uint32(spawn.spawnDifficulties.size());
+    for (Difficulty difficulty : spawn.spawnDifficulties)
+        data << uint8(difficulty);
+    data << GetScriptName(spawn.scriptId);
+    data << spawn.StringId;
+}
+
+void ObjectMgr::ReadSpawnDataSnapshot(StartupSnapshotReader& data, SpawnData& spawn)
+{
+    spawn.id = data.read<uint32>();
+    spawn.mapId = data.read<uint32>();
+    float x = data.read<float>();
+    float y = data.read<float>();
+    float z = data.read<float>();
+    float o = data.read<float>();
+    spawn.spawnPoint.Relocate(x, y, z, o);
+    spawn.phaseUseFlags = data.read<uint8>();
+    spawn.phaseId = data.read<uint32>();
+    spawn.phaseGroup = data.read<uint32>();
+    spawn.terrainSwapMap = data.read<int32>();
+    spawn.poolId = data.read<uint32>();
+    spawn.spawntimesecs = data.read<int32>();
+    spawn.spawnDifficulties.resize(data.ReadCount());
+    for (Difficulty& difficulty : spawn.spawnDifficulties)
+        difficulty = Difficulty(data.read<uint8>());
+    spawn.scriptId = GetScriptId(std::string(data.ReadCString()));
+    spawn.StringId = data.ReadCString();
+    spawn.spawnGroupData = IsTransportMap(spawn.mapId) ? GetLegacySpawnGroup() : GetDefaultSpawnGroup();
+}
+
+void ObjectMgr::WriteCreatureSnapshot(ByteBuffer& data) const
+{
+    // spawns rejected by LoadCreatures stay in the store without being added to grid
+    data << uint32(_creatureDataStore.size());
+    for (auto const& [spawnId, creature] : _creatureDataStore)
+    {
+        WriteSpawnDataSnapshot(data, creature);
+        data << uint8(creature.display.has_value());
+        if (creature.display)
+        {
+            data << uint32(creature.display->CreatureDisplayID);
+            data << float(creature.display->DisplayScale);
+            data << float(creature.display->Probability);
+        }
+        data << int8(creature.equipmentId);
+        data << float(creature.wander_distance);
+        data << uint32(creature.currentwaypoint);
+        data << uint32(creature.curHealthPct);
+        data << uint8(creature.movementType);
+        data << uint8(creature.npcflag.has_value());
+        data << uint64(creature.npcflag.value_or(0));
+        data << uint8(creature.unit_flags.has_value());
+        data << uint32(creature.unit_flags.value_or(0));
+        data << uint8(creature.unit_flags2.has_value());
+        data << uint32(creature.unit_flags2.value_or(0));
+        data << uint8(creature.unit_flags3.has_value());
+        data << uint32(creature.unit_flags3.value_or(0));
+        data << uint8(IsSpawnDataInGrid<&CellObjectGuids::creatures>(&creature));
+    }
+}
+
+void ObjectMgr::ReadCreatureSnapshot(StartupSnapshotReader& data)
+{
+    CreatureDataContainer creatureDataStore;
+    std::vector<CreatureData const*> gridSpawns;
+
+    auto readOptional = [&data]<typename T>(Optional<T>& value)
+    {
+        bool hasValue = data.read<uint8>() != 0;
+        T readValue = data.read<T>();
+        if (hasValue)
+            value = readValue;
+    };
+
+    uint32 creatureCount = data.ReadCount();
+    creatureDataStore.reserve(creatureCount);
+    gridSpawns.reserve(creatureCount);
+    for (uint32 i = 0; i < creatureCount; ++i)
+    {
+        ObjectGuid::LowType spawnId = data.read<uint64>();
+        CreatureData& creature = creatureDataStore[spawnId];
+        creature.spawnId = spawnId;
+        ReadSpawnDataSnapshot(data, creature);
+        if (data.read<uint8>())
+        {
+            uint32 displayId = data.read<uint32>();
+            float displayScale = data.read<float>();
+            float probability = data.read<float>();
+            creature.display.emplace(displayId, displayScale, probability);
+        }
+        creature.equipmentId = data.read<int8>();
+        creature.wander_distance = data.read<float>();
+        creature.currentwaypoint = data.read<uint32>();
+        creature.curHealthPct = data.read<uint32>();
+        creature.movementType = data.read<uint8>();
+        readOptional(creature.npcflag);
+        readOptional(creature.unit_flags);
+        readOptional(creature.unit_flags2);
+        readOptional(creature.unit_flags3);
+        if (data.read<uint8>())
+            gridSpawns.push_back(&creature);
+    }
+
+    data.ReadEnd();
+    _creatureDataStore = std::move(creatureDataStore);
+    for (CreatureData const* creature : gridSpawns)
+        AddCreatureToGrid(creature);
+}
+
+void ObjectMgr::WriteGameObjectSnapshot(ByteBuffer& data) const
+{
+    // spawns rejected by LoadGameObjects stay in the store without being added to grid
+    data << uint32(_gameObjectDataStore.size());
+    for (auto const& [spawnId, gameObject] : _gameObjectDataStore)
+    {
+        WriteSpawnDataSnapshot(data, gameObject);
+        data << float(gameObject.rotation.x);
+        data << float(gameObject.rotation.y);
+        data << float(gameObject.rotation.z);
+        data << float(gameObject.rotation.w);
+        data << uint32(gameObject.animprogress);
+        data << uint8(gameObject.goState);
+        data << uint32(gameObject.artKit);
+        data << uint8(IsSpawnDataInGrid<&CellObjectGuids::gameobjects>(&gameObject));
+    }
+}
+
+void ObjectMgr::ReadGameObjectSnapshot(StartupSnapshotReader& data)
+{
+    GameObjectDataContainer gameObjectDataStore;
+    std::vector<GameObjectData const*> gridSpawns;
+
+    uint32 gameObjectCount = data.ReadCount();
+    gameObjectDataStore.reserve(gameObjectCount);
+    gridSpawns.reserve(gameObjectCount);
+    for (uint32 i = 0; i < gameObjectCount; ++i)
+    {
+        ObjectGuid::LowType spawnId = data.read<uint64>();
+        GameObjectData& gameObject = gameObjectDataStore[spawnId];
+        gameObject.spawnId = spawnId;
+        ReadSpawnDataSnapshot(data, gameObject);
+        gameObject.rotation.x = data.read<float>();
+        gameObject.rotation.y = data.read<float>();
+        gameObject.rotation.z = data.read<float>();
+        gameObject.rotation.w = data.read<float>();
+        gameObject.animprogress = data.read<uint32>();
+        gameObject.goState = GOState(data.read<uint8>());
+        gameObject.artKit = data.read<uint32>();
+        if (data.read<uint8>())
+            gridSpawns.push_back(&gameObject);
+    }
+
+    data.ReadEnd();
+    _gameObjectDataStore = std::move(gameObjectDataStore);
+    for (GameObjectData const* gameObject : gridSpawns)
+        AddGameobjectToGrid(gameObject);
+}
+
 void ObjectMgr::LoadSpawnGroupTemplates()
 {
     uint32 oldMSTime = getMSTime();
@@ -10028,6 +10494,7 @@ void ObjectMgr::ScriptNameContainer::reserve(size_t capacity)
 
 uint32 ObjectMgr::ScriptNameContainer::insert(std::string const& scriptName, bool isScriptNameBound)
 {
+    std::lock_guard<std::mutex> lock(Lock);
     auto result = NameToIndex.try_emplace(scriptName, static_cast<uint32>(NameToIndex.size()), isScriptNameBound);
     if (result.second)
     {
@@ -10045,6 +10512,7 @@ size_t ObjectMgr::ScriptNameContainer::size() const
 
 ObjectMgr::ScriptNameContainer::NameMap::const_iterator ObjectMgr::ScriptNameContainer::find(size_t index) const
 {
+    std::lock_guard<std::mutex> lock(Lock);
     return index < IndexToName.size() ? IndexToName[index] : end();
 }
 
@@ -10054,6 +10522,7 @@ ObjectMgr::ScriptNameContainer::NameMap::const_iterator ObjectMgr::ScriptNameCon
     if (name.empty())
         return end();
 
+    std::lock_guard<std::mutex> lock(Lock);
     return NameToIndex.find(name);
 }
 
@@ -42,9 +42,12 @@
 #include <atomic>
 #include <iterator>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 
+class ByteBuffer;
 class Item;
+class StartupSnapshotReader;
 class Unit;
 class Vehicle;
 class Map;
@@ -1018,6 +1021,7 @@ class TC_GAME_API ObjectMgr
 
             NameMap NameToIndex;
             std::vector<NameMap::const_iterator> IndexToName;
+            mutable std::mutex Lock;  // loaders running in parallel at startup insert and look up names concurrently
 
         public:
             ScriptNameContainer();
@@ -1256,6 +1260,29 @@ class TC_GAME_API ObjectMgr
         void LoadSpawnGroupTemplates();
         void LoadSpawnGroups();
         void LoadInstanceSpawnGroups();
+
+        // Startup snapshots of template and spawn stores, see StartupSnapshot
+        // Spawns must be read after templates, they are checked against transport maps of gameobject templates
+        static constexpr std::string_view CreatureTemplateSnapshotName = "creature_templates";
+        static constexpr uint32 CreatureTemplateSnapshotVersion = 1;
+        void WriteCreatureTemplateSnapshot(ByteBuffer& data) const;
+        void ReadCreatureTemplateSnapshot(StartupSnapshotReader& data);
+
+        static constexpr std::string_view GameObjectTemplateSnapshotName = "gameobject_templates";
+        static constexpr uint32 GameObjectTemplateSnapshotVersion = 1;
+        void WriteGameObjectTemplateSnapshot(ByteBuffer& data) const;
+        void ReadGameObjectTemplateSnapshot(StartupSnapshotReader& data);
+
+        // Must be invalidated after writing to `creature` or `gameobject`, the snapshot would revert the change on next startup
+        static constexpr std::string_view CreatureSnapshotName = "creatures";
+        static constexpr uint32 CreatureSnapshotVersion = 1;
+        void WriteCreatureSnapshot(ByteBuffer& data) const;
+        void ReadCreatureSnapshot(StartupSnapshotReader& data);
+
+        static constexpr std::string_view GameObjectSnapshotName = "gameobjects";
+        static constexpr uint32 GameObjectSnapshotVersion = 1;
+        void WriteGameObjectSnapshot(ByteBuffer& data) const;
+        void ReadGameObjectSnapshot(StartupSnapshotReader& data);
         void LoadItemTemplates();
         void LoadItemTemplateAddon();
         void LoadItemScriptNames();
@@ -1797,6 +1824,12 @@ class TC_GAME_API ObjectMgr
         template<CellGuidSet CellObjectGuids::*guids>
         void RemoveSpawnDataFromGrid(SpawnData const* data);
 
+        template<CellGuidSet CellObjectGuids::*guids>
+        bool IsSpawnDataInGrid(SpawnData const* data) const;
+
+        void WriteSpawnDataSnapshot(ByteBuffer& data, SpawnData const& spawn) const;
+        void ReadSpawnDataSnapshot(StartupSnapshotReader& data, SpawnData& spawn);
+
         MailLevelRewardContainer _mailLevelRewardStore;
 
         CreatureBaseStatsContainer _creatureBaseStatsStore;
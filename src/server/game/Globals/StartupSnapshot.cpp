@@ -0,0 +1,187 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupSnapshot.h"
+#include "Log.h"
+#include "MappedFile.h"
+#include "Memory.h"
+#include "StringFormat.h"
+#include "Timer.h"
+#include <boost/filesystem/operations.hpp>
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+constexpr uint32 SnapshotMagic = 'T' | 'C' << 8 | 'S' << 16 | 'S' << 24;
+}
+
+std::string_view StartupSnapshotReader::ReadCString()
+{
+    // written by this core, not validated as utf8 again
+    char const* begin = reinterpret_cast<char const*>(_data.data()) + _rpos;
+    char const* end = reinterpret_cast<char const*>(_data.data()) + _data.size();
+    char const* stringEnd = std::find(begin, end, '\0');
+    if (stringEnd == end)
+        throw ByteBufferPositionException(_data.size(), _data.size(), 1);
+
+    std::string_view value(begin, stringEnd);
+    _rpos += value.length() + 1;
+    return value;
+}
+
+uint32 StartupSnapshotReader::ReadCount()
+{
+    uint32 count = read<uint32>();
+    if (count > _data.size() - _rpos)
+        throw ByteBufferPositionException(_rpos, _data.size(), count);
+    return count;
+}
+
+void StartupSnapshotReader::ReadEnd() const
+{
+    if (_rpos != _data.size())
+        throw ByteBufferException(Trinity::StringFormat("{} unread bytes", _data.size() - _rpos));
+}
+
+StartupSnapshot::StartupSnapshot() = default;
+StartupSnapshot::~StartupSnapshot() = default;
+
+StartupSnapshot* StartupSnapshot::instance()
+{
+    static StartupSnapshot instance;
+    return &instance;
+}
+
+void StartupSnapshot::Initialize(std::string directory, std::string worldDatabaseKey)
+{
+    _directory = std::move(directory);
+    _key = std::move(worldDatabaseKey);
+    if (!IsEnabled())
+        return;
+
+    if (_directory.back() != '/' && _directory.back() != '\\')
+        _directory.push_back('/');
+
+    boost::system::error_code error;
+    boost::filesystem::create_directories(_directory, error);
+    if (error)
+    {
+        TC_LOG_ERROR("server.loading", "Startup snapshot directory {} could not be created ({}), snapshots are disabled", _directory, error.message());
+        _directory.clear();
+        return;
+    }
+
+    TC_LOG_INFO("server.loading", "Using startup snapshots in {} for world database {}", _directory, _key);
+}
+
+void StartupSnapshot::Load(std::string_view name, uint32 version, std::function<void()> const& loadFromDB,
+    std::function<void(ByteBuffer&)> const& write, std::function<void(StartupSnapshotReader&)> const& read) const
+{
+    if (!IsEnabled())
+    {
+        loadFromDB();
+        return;
+    }
+
+    std::string fileName = GetFileName(name);
+    if (std::unique_ptr<Trinity::MappedFile> file = Trinity::MappedFile::Open(fileName.c_str()))
+    {
+        uint32 oldMSTime = getMSTime();
+        StartupSnapshotReader data(file->GetData());
+        try
+        {
+            if (ReadHeader(data, version, _key))
+            {
+                read(data);
+                TC_LOG_INFO("server.loading", ">> Loaded {} from startup snapshot ({} bytes) in {} ms", name, data.size(), GetMSTimeDiffToNow(oldMSTime));
+                return;
+            }
+
+            TC_LOG_INFO("server.loading", "Startup snapshot {} is stale, loading from database", fileName);
+        }
+        catch (ByteBufferException const& e)
+        {
+            TC_LOG_ERROR("server.loading", "Startup snapshot {} is corrupted ({}), loading from database", fileName, e.what());
+        }
+    }
+
+    loadFromDB();
+
+    ByteBuffer data;
+    WriteHeader(data, version, _key);
+    write(data);
+    if (WriteFile(fileName, data))
+        TC_LOG_INFO("server.loading", ">> Wrote startup snapshot {} ({} bytes)", fileName, data.size());
+}
+
+void StartupSnapshot::Invalidate(std::string_view name) const
+{
+    if (!IsEnabled())
+        return;
+
+    std::string fileName = GetFileName(name);
+    boost::system::error_code error;
+    if (boost::filesystem::remove(fileName, error))
+        TC_LOG_DEBUG("misc", "Startup snapshot {} removed, world database was changed", fileName);
+    else if (error)
+        TC_LOG_ERROR("misc", "Startup snapshot {} could not be removed ({}), delete it before next startup", fileName, error.message());
+}
+
+void StartupSnapshot::WriteHeader(ByteBuffer& data, uint32 version, std::string_view key)
+{
+    data << uint32(SnapshotMagic);
+    data << uint32(version);
+    data << key;
+}
+
+bool StartupSnapshot::ReadHeader(StartupSnapshotReader& data, uint32 version, std::string_view key)
+{
+    return data.read<uint32>() == SnapshotMagic
+        && data.read<uint32>() == version
+        && data.ReadCString() == key;
+}
+
+std::string StartupSnapshot::GetFileName(std::string_view name) const
+{
+    return Trinity::StringFormat("{}{}.snapshot", _directory, name);
+}
+
+bool StartupSnapshot::WriteFile(std::string const& fileName, ByteBuffer const& data) const
+{
+    // write to a temporary file first, a server stopped while writing must not leave a truncated snapshot behind
+    std::string tempFileName = fileName + ".tmp";
+    {
+        auto file = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(tempFileName.c_str(), "wb"));
+        if (!file || fwrite(data.data(), 1, data.size(), file.get()) != data.size())
+        {
+            TC_LOG_ERROR("server.loading", "Startup snapshot {} could not be written", tempFileName);
+            return false;
+        }
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::rename(tempFileName, fileName, error);
+    if (error)
+    {
+        TC_LOG_ERROR("server.loading", "Startup snapshot {} could not be replaced ({})", fileName, error.message());
+        boost::filesystem::remove(tempFileName, error);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,113 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_STARTUP_SNAPSHOT_H
+#define TRINITYCORE_STARTUP_SNAPSHOT_H
+
+#include "ByteBuffer.h"
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+
+/*
+ * Reads a snapshot directly from its mapped file, values are decoded in place without copying the file first.
+ * Reading past the end throws ByteBufferPositionException, same as ByteBuffer.
+ */
+class TC_GAME_API StartupSnapshotReader
+{
+public:
+    explicit StartupSnapshotReader(std::span<uint8 const> data) : _data(data), _rpos(0) { }
+
+    template <ByteBufferNumeric T>
+    T read()
+    {
+        if (_rpos + sizeof(T) > _data.size())
+            throw ByteBufferPositionException(_rpos, _data.size(), sizeof(T));
+
+        T value;
+        std::memcpy(&value, _data.data() + _rpos, sizeof(T));
+        EndianConvert(value);
+        _rpos += sizeof(T);
+        return value;
+    }
+
+    // view into the mapped file, only valid while reading
+    std::string_view ReadCString();
+
+    // every element takes at least one byte, larger counts can only come from a corrupted snapshot
+    uint32 ReadCount();
+
+    // throws if any data is left, call before replacing loaded data with what was read
+    void ReadEnd() const;
+
+    std::size_t size() const { return _data.size(); }
+
+private:
+    std::span<uint8 const> _data;
+    std::size_t _rpos;
+};
+
+/*
+ * Binary copies of fully loaded world database stores, written after loading them from database
+ * and read instead of querying database on next startup.
+ * Every snapshot is tied to the core revision and the updates applied to world database when it was written,
+ * applying any update makes all snapshots stale and they are rewritten on next startup.
+ * Changes made directly to world database without an update are not detected.
+ */
+class TC_GAME_API StartupSnapshot
+{
+public:
+    StartupSnapshot(StartupSnapshot const&) = delete;
+    StartupSnapshot(StartupSnapshot&&) = delete;
+    StartupSnapshot& operator=(StartupSnapshot const&) = delete;
+    StartupSnapshot& operator=(StartupSnapshot&&) = delete;
+
+    static StartupSnapshot* instance();
+
+    // empty directory disables snapshots
+    void Initialize(std::string directory, std::string worldDatabaseKey);
+
+    bool IsEnabled() const { return !_directory.empty(); }
+
+    // Reads store from its snapshot if it matches current world database, otherwise loads it with loadFromDB and writes a new snapshot.
+    // read must call ReadEnd before replacing previously loaded data, a snapshot that fails to read is discarded and store is loaded from database instead.
+    // Bump version whenever the layout written by write changes.
+    void Load(std::string_view name, uint32 version, std::function<void()> const& loadFromDB,
+        std::function<void(ByteBuffer&)> const& write, std::function<void(StartupSnapshotReader&)> const& read) const;
+
+    // Removes snapshot of a store whose world database tables were changed while running, next startup loads it from database again.
+    void Invalidate(std::string_view name) const;
+
+    // header written before store data, ReadHeader returns false for snapshots of a different version or world database
+    static void WriteHeader(ByteBuffer& data, uint32 version, std::string_view key);
+    static bool ReadHeader(StartupSnapshotReader& data, uint32 version, std::string_view key);
+
+private:
+    StartupSnapshot();
+    ~StartupSnapshot();
+
+    std::string GetFileName(std::string_view name) const;
+    bool WriteFile(std::string const& fileName, ByteBuffer const& data) const;
+
+    std::string _directory;
+    std::string _key;
+};
+
+#define sStartupSnapshot StartupSnapshot::instance()
+
+#endif // TRINITYCORE_STARTUP_SNAPSHOT_H
@@ -117,6 +117,7 @@ struct Cell
     template<class T> static void VisitAllObjects(float x, float y, Map* map, T& visitor, float radius, bool dont_load = true);
 
 private:
+    template<class T> static void SetSearchArea(T& visitor, float x, float y, float radius);
     template<class T, class CONTAINER> void VisitCircle(TypeContainerVisitor<T, CONTAINER> &, Map &, CellCoord const&, CellCoord const&) const;
 };
 
@@ -57,6 +57,15 @@ inline CellArea Cell::CalculateCellArea(float x, float y, float radius)
     return CellArea(centerX, centerY);
 }
 
+template<class T>
+inline void Cell::SetSearchArea(T& visitor, float x, float y, float radius)
+{
+    // lets searchers reject objects beyond radius before evaluating their checks
+    if constexpr (requires { visitor.SetSearchArea(x, y, radius); })
+        if (radius > 0.0f)
+            visitor.SetSearchArea(x, y, radius + GRID_SEARCH_RANGE_MARGIN);
+}
+
 template<class T, class CONTAINER>
 inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T, CONTAINER>& visitor, Map& map, WorldObject const& obj, float radius) const
 {
@@ -183,6 +192,8 @@ inline void Cell::VisitGridObjects(WorldObject const* center_obj, T& visitor, fl
     if (dont_load)
         cell.SetNoCreate();
 
+    SetSearchArea(visitor, center_obj->GetPositionX(), center_obj->GetPositionY(), radius + center_obj->GetCombatReach());
+
     TypeContainerVisitor<T, GridTypeMapContainer> gnotifier(visitor);
     cell.Visit(p, gnotifier, *center_obj->GetMap(), *center_obj, radius);
 }
@@ -195,6 +206,8 @@ inline void Cell::VisitWorldObjects(WorldObject const* center_obj, T& visitor, f
     if (dont_load)
         cell.SetNoCreate();
 
+    SetSearchArea(visitor, center_obj->GetPositionX(), center_obj->GetPositionY(), radius + center_obj->GetCombatReach());
+
     TypeContainerVisitor<T, WorldTypeMapContainer> gnotifier(visitor);
     cell.Visit(p, gnotifier, *center_obj->GetMap(), *center_obj, radius);
 }
@@ -207,6 +220,8 @@ inline void Cell::VisitAllObjects(WorldObject const* center_obj, T& visitor, flo
     if (dont_load)
         cell.SetNoCreate();
 
+    SetSearchArea(visitor, center_obj->GetPositionX(), center_obj->GetPositionY(), radius + center_obj->GetCombatReach());
+
     TypeContainerVisitor<T, WorldTypeMapContainer> wnotifier(visitor);
     cell.Visit(p, wnotifier, *center_obj->GetMap(), *center_obj, radius);
     TypeContainerVisitor<T, GridTypeMapContainer> gnotifier(visitor);
@@ -221,6 +236,8 @@ inline void Cell::VisitGridObjects(float x, float y, Map* map, T& visitor, float
     if (dont_load)
         cell.SetNoCreate();
 
+    SetSearchArea(visitor, x, y, radius);
+
     TypeContainerVisitor<T, GridTypeMapContainer> gnotifier(visitor);
     cell.Visit(p, gnotifier, *map, x, y, radius);
 }
@@ -233,6 +250,8 @@ inline void Cell::VisitWorldObjects(float x, float y, Map* map, T& visitor, floa
     if (dont_load)
         cell.SetNoCreate();
 
+    SetSearchArea(visitor, x, y, radius);
+
     TypeContainerVisitor<T, WorldTypeMapContainer> gnotifier(visitor);
     cell.Visit(p, gnotifier, *map, x, y, radius);
 }
@@ -245,6 +264,8 @@ inline void Cell::VisitAllObjects(float x, float y, Map* map, T& visitor, float
     if (dont_load)
         cell.SetNoCreate();
 
+    SetSearchArea(visitor, x, y, radius);
+
     TypeContainerVisitor<T, WorldTypeMapContainer> wnotifier(visitor);
     cell.Visit(p, wnotifier, *map, x, y, radius);
     TypeContainerVisitor<T, GridTypeMapContainer> gnotifier(visitor);
@@ -47,6 +47,9 @@ class Conversation;
 
 #define SIZE_OF_GRID_CELL       (SIZE_OF_GRIDS/MAX_NUMBER_OF_CELLS)
 
+// added to the radius of grid searches when rejecting objects by their packed cell positions (combat reach of found objects is already included)
+#define GRID_SEARCH_RANGE_MARGIN 10.0f
+
 #define CENTER_GRID_CELL_ID     (MAX_NUMBER_OF_CELLS*MAX_NUMBER_OF_GRIDS/2)
 #define CENTER_GRID_CELL_OFFSET (SIZE_OF_GRID_CELL/2)
 
@@ -18,14 +18,110 @@
 #ifndef _GRIDREFMANAGER
 #define _GRIDREFMANAGER
 
+#include "Define.h"
 #include "RefManager.h"
+#include <algorithm>
+#include <array>
+#include <vector>
 
 template<class OBJECT>
 class GridReference;
 
+// whether GridRefManager keeps packed positions of linked objects, disabled for containers of non-world objects (NGrid)
+template<class OBJECT>
+constexpr bool IsGridPackedObject = true;
+
+// number of candidates collected by a single distance pass of GridRefManager::VisitInRange
+constexpr std::size_t GRID_PACKED_VISIT_BATCH = 64;
+
 template<class OBJECT>
 class GridRefManager : public RefManager<GridReference<OBJECT>>
 {
+    public:
+        ~GridRefManager() { this->clearReferences(); }
+
+        // changes every time an object enters or leaves this container
+        uint32 GetVersion() const { return _version; }
+        void IncVersion() { ++_version; }
+
+        /*
+         * Besides the intrusive list, every linked object is kept in a dense array together with
+         * a copy of its 2d position and combat reach (structure of arrays, removal swaps with the last element).
+         * Range searches reject candidates with a linear pass over the positions before touching
+         * the objects themselves.
+         * Values are captured on link and refreshed through GridObject::UpdateGridPosition
+         * by WorldObject::Relocate and Unit::SetCombatReach.
+         */
+        void AddPacked(GridReference<OBJECT>* ref)
+        {
+            ref->SetPackedIndex(uint32(_packedRefs.size()));
+            _packedRefs.push_back(ref);
+            _packedX.push_back(ref->GetSource()->GetPositionX());
+            _packedY.push_back(ref->GetSource()->GetPositionY());
+            _packedReach.push_back(ref->GetSource()->GetCombatReach());
+        }
+
+        void RemovePacked(GridReference<OBJECT> const* ref)
+        {
+            uint32 index = ref->GetPackedIndex();
+            uint32 last = uint32(_packedRefs.size() - 1);
+            if (index != last)
+            {
+                _packedRefs[index] = _packedRefs[last];
+                _packedX[index] = _packedX[last];
+                _packedY[index] = _packedY[last];
+                _packedReach[index] = _packedReach[last];
+                _packedRefs[index]->SetPackedIndex(index);
+            }
+
+            _packedRefs.pop_back();
+            _packedX.pop_back();
+            _packedY.pop_back();
+            _packedReach.pop_back();
+        }
+
+        void UpdatePacked(GridReference<OBJECT> const* ref)
+        {
+            uint32 index = ref->GetPackedIndex();
+            _packedX[index] = ref->GetSource()->GetPositionX();
+            _packedY[index] = ref->GetSource()->GetPositionY();
+            _packedReach[index] = ref->GetSource()->GetCombatReach();
+        }
+
+        // calls visitor for every object within 2d range of x, y (extended by combat reach of the object) until it returns false
+        // visitor must not add or remove objects of this container
+        template<typename Visitor>
+        void VisitInRange(float x, float y, float range, Visitor&& visitor) const
+        {
+            std::size_t const count = _packedRefs.size();
+            std::array<uint32, GRID_PACKED_VISIT_BATCH> candidates;
+            for (std::size_t begin = 0; begin < count; begin += GRID_PACKED_VISIT_BATCH)
+            {
+                std::size_t const end = std::min(count, begin + GRID_PACKED_VISIT_BATCH);
+                std::size_t found = 0;
+
+                // branchless so that the distance computation can be vectorized
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    float dx = _packedX[i] - x;
+                    float dy = _packedY[i] - y;
+                    float maxDist = range + _packedReach[i];
+                    candidates[found] = uint32(i);
+                    found += (dx * dx + dy * dy <= maxDist * maxDist) ? 1 : 0;
+                }
+
+                for (std::size_t i = 0; i < found; ++i)
+                    if (!visitor(_packedRefs[candidates[i]]->GetSource()))
+                        return;
+            }
+        }
+
+    private:
+        std::vector<GridReference<OBJECT>*> _packedRefs;
+        std::vector<float> _packedX;
+        std::vector<float> _packedY;
+        std::vector<float> _packedReach;
+        uint32 _version = 0;
 };
 
 template <typename ObjectType>
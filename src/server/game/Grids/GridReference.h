@@ -19,9 +19,7 @@
 #define _GRIDREFERENCE_H
 
 #include "LinkedReference/Reference.h"
-
-template<class OBJECT>
-class GridRefManager;
+#include "GridRefManager.h"
 
 template<class OBJECT>
 class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT, GridReference<OBJECT>>
@@ -33,19 +31,40 @@ class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT, GridRefer
             // called from link()
             this->getTarget()->insertFirst(this);
             this->getTarget()->incSize();
+            this->getTarget()->IncVersion();
+            if constexpr (IsGridPackedObject<OBJECT>)
+                this->getTarget()->AddPacked(this);
         }
         void targetObjectDestroyLink()
         {
             // called from unlink()
-            if (this->isValid()) this->getTarget()->decSize();
+            if (this->isValid())
+            {
+                this->getTarget()->decSize();
+                this->getTarget()->IncVersion();
+                if constexpr (IsGridPackedObject<OBJECT>)
+                    this->getTarget()->RemovePacked(this);
+            }
         }
         void sourceObjectDestroyLink()
         {
             // called from invalidate()
             this->getTarget()->decSize();
+            this->getTarget()->IncVersion();
+            if constexpr (IsGridPackedObject<OBJECT>)
+                this->getTarget()->RemovePacked(this);
         }
     public:
         GridReference() = default;
         ~GridReference() { this->unlink(); }
+
+        // refreshes position stored in the packed storage of the container after the object moved
+        void UpdatePackedPosition() { this->getTarget()->UpdatePacked(this); }
+
+        uint32 GetPackedIndex() const { return _packedIndex; }
+        void SetPackedIndex(uint32 index) { _packedIndex = index; }
+
+    private:
+        uint32 _packedIndex = 0;
 };
 #endif
@@ -60,6 +60,17 @@ typedef enum
     MAX_GRID_STATE = 4
 } grid_state_t;
 
+template
+<
+uint32 N,
+class WORLD_OBJECT_CONTAINER,
+class GRID_OBJECT_CONTAINER
+>
+class NGrid;
+
+template<uint32 N, class WORLD_OBJECT_CONTAINER, class GRID_OBJECT_CONTAINER>
+constexpr bool IsGridPackedObject<NGrid<N, WORLD_OBJECT_CONTAINER, GRID_OBJECT_CONTAINER>> = false;
+
 template
 <
 uint32 N,
@@ -22,11 +22,12 @@
 #include "ObjectAccessor.h"
 #include "Transport.h"
 #include "UpdateData.h"
+#include "VisibilityTracker.h"
 #include "WorldPacket.h"
 
 using namespace Trinity;
 
-VisibleNotifier::VisibleNotifier(Player& player): i_player(player), i_data(player.GetMapId()), vis_guids(player.m_clientGUIDs)
+VisibleNotifier::VisibleNotifier(Player& player): i_player(player), i_data(player.GetMapId()), i_incremental(false), i_skipVisibility(false)
 {
 }
 
@@ -34,14 +35,22 @@ VisibleNotifier::~VisibleNotifier() = default;
 
 void VisibleNotifier::SendToSelf()
 {
+    std::sort(i_visitedGuids.begin(), i_visitedGuids.end());
+    auto isVisited = [this](ObjectGuid const& guid)
+    {
+        return std::binary_search(i_visitedGuids.begin(), i_visitedGuids.end(), guid);
+    };
+
     // at this moment i_clientGUIDs have guids that not iterate at grid level checks
     // but exist one case when this possible and object not out of range: transports
+    std::vector<ObjectGuid> passengers;
     if (Transport* transport = dynamic_cast<Transport*>(i_player.GetTransport()))
     {
         for (WorldObject* passenger : transport->GetPassengers())
         {
-            if (vis_guids.erase(passenger->GetGUID()) > 0)
+            if (i_player.m_clientGUIDs.contains(passenger->GetGUID()) && !isVisited(passenger->GetGUID()))
             {
+                passengers.push_back(passenger->GetGUID());
                 switch (passenger->GetTypeId())
                 {
                     case TYPEID_GAMEOBJECT:
@@ -68,16 +77,25 @@ void VisibleNotifier::SendToSelf()
         }
     }
 
-    for (ObjectGuid const& outOfRangeGuid : vis_guids)
+    // objects outside of visited cells are left alone by incremental passes, they are handled by their own relocation
+    if (!i_incremental)
     {
-        i_player.m_clientGUIDs.erase(outOfRangeGuid);
-        i_data.AddOutOfRangeGUID(outOfRangeGuid);
+        std::vector<ObjectGuid> outOfRangeGuids;
+        for (ObjectGuid const& guid : i_player.m_clientGUIDs)
+            if (!isVisited(guid) && std::find(passengers.begin(), passengers.end(), guid) == passengers.end())
+                outOfRangeGuids.push_back(guid);
 
-        if (outOfRangeGuid.IsPlayer())
+        for (ObjectGuid const& outOfRangeGuid : outOfRangeGuids)
         {
-            Player* player = ObjectAccessor::GetPlayer(i_player, outOfRangeGuid);
-            if (player && !player->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
-                player->UpdateVisibilityOf(&i_player);
+            i_player.m_clientGUIDs.erase(outOfRangeGuid);
+            i_data.AddOutOfRangeGUID(outOfRangeGuid);
+
+            if (outOfRangeGuid.IsPlayer())
+            {
+                Player* player = ObjectAccessor::GetPlayer(i_player, outOfRangeGuid);
+                if (player && !player->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
+                    player->UpdateVisibilityOf(&i_player);
+            }
         }
     }
 
@@ -145,9 +163,13 @@ void PlayerRelocationNotifier::Visit(PlayerMapType &m)
     {
         Player* player = iter->GetSource();
 
-        vis_guids.erase(player->GetGUID());
+        // only our own view of the cell is known to be unchanged, other players still see us move
+        if (!i_skipVisibility || player->IsVisibilityOverridden())
+        {
+            i_visitedGuids.push_back(player->GetGUID());
 
-        i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+            i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+        }
 
         if (player->m_seer->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
             continue;
@@ -164,9 +186,13 @@ void PlayerRelocationNotifier::Visit(CreatureMapType &m)
     {
         Creature* c = iter->GetSource();
 
-        vis_guids.erase(c->GetGUID());
+        // ai still has to see the movement even if visibility cannot change
+        if (!i_skipVisibility || c->IsVisibilityOverridden())
+        {
+            i_visitedGuids.push_back(c->GetGUID());
 
-        i_player.UpdateVisibilityOf(c, i_data, i_visibleNow);
+            i_player.UpdateVisibilityOf(c, i_data, i_visibleNow);
+        }
 
         if (relocated_for_ai && !c->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
             CreatureUnitRelocationWorker(c, &i_player);
@@ -233,7 +259,7 @@ void DelayedUnitRelocation::Visit(PlayerMapType &m)
             continue;
 
         PlayerRelocationNotifier relocate(*player);
-        Cell::VisitAllObjects(viewPoint, relocate, i_radius, false);
+        VisitObjectsForVisibility(*player, relocate, i_radius, false);
         relocate.SendToSelf();
     }
 }
@@ -26,6 +26,7 @@
 #include "GameObject.h"
 #include "Player.h"
 #include "SceneObject.h"
+#include "SharedWorldPacket.h"
 #include "Spell.h"
 #include "SpellInfo.h"
 #include "UnitAI.h"
@@ -49,8 +50,10 @@ namespace Trinity
     {
         Player &i_player;
         UpdateData i_data;
-        std::set<WorldObject*> i_visibleNow;
-        GuidUnorderedSet vis_guids;
+        std::vector<WorldObject*> i_visibleNow;
+        std::vector<ObjectGuid> i_visitedGuids;     // sorted in SendToSelf, objects at client not in here are out of range
+        bool i_incremental;                         // only part of the cells was visited, keep unvisited objects at client
+        bool i_skipVisibility;                      // objects in the cell being visited without visibility override cannot change visibility for i_player
 
         VisibleNotifier(Player &player);
         ~VisibleNotifier();
@@ -148,8 +151,9 @@ namespace Trinity
     struct PacketSenderRef
     {
         WorldPacket const* Data;
+        WorldPacketBroadcast Broadcast;
 
-        PacketSenderRef(WorldPacket const* message) : Data(message) { }
+        PacketSenderRef(WorldPacket const* message) : Data(message), Broadcast(*message) { }
 
         void operator()(Player const* player) const
         {
@@ -355,6 +359,18 @@ namespace Trinity
         MapTypeMaskCheck i_mapTypeMask;
         PhaseShift const* i_phaseShift;
         Check& i_check;
+        float i_searchX;
+        float i_searchY;
+        float i_searchRange;
+
+        // objects beyond range of x, y are rejected using packed cell positions before evaluating the check
+        // set by Cell::Visit*Objects from their search radius
+        void SetSearchArea(float x, float y, float range)
+        {
+            i_searchX = x;
+            i_searchY = y;
+            i_searchRange = range;
+        }
 
         template<class T>
         void Visit(GridRefManager<T>& m)
@@ -374,11 +390,15 @@ namespace Trinity
     protected:
         template<typename Container>
         WorldObjectSearcherBase(PhaseShift const& phaseShift, Container& result, Check& check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
-            : Result(result), i_mapTypeMask(mapTypeMask), i_phaseShift(&phaseShift), i_check(check) { }
+            : Result(result), i_mapTypeMask(mapTypeMask), i_phaseShift(&phaseShift), i_check(check),
+            i_searchX(0.0f), i_searchY(0.0f), i_searchRange(0.0f) { }
 
     private:
         template<class T>
         void VisitImpl(GridRefManager<T>&);
+
+        template<class T>
+        bool VisitObject(T* object);
     };
 
     template<class Work, class MapTypeMaskCheck = DynamicGridMapTypeMaskCheck>
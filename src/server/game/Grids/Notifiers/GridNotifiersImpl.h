@@ -29,7 +29,11 @@ inline void Trinity::VisibleNotifier::Visit(GridRefManager<T> &m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
-        vis_guids.erase(iter->GetSource()->GetGUID());
+        // visibility distance override is not covered by cell classification
+        if (i_skipVisibility && !iter->GetSource()->IsVisibilityOverridden())
+            continue;
+
+        i_visitedGuids.push_back(iter->GetSource()->GetGUID());
         i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
     }
 }
@@ -187,19 +191,33 @@ inline void Trinity::WorldObjectSearcherBase<Check, Result, MapTypeMaskCheck>::V
     if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
         return;
 
-    for (GridReference<T> const& ref : m)
+    if (i_searchRange > 0.0f)
     {
-        if (!ref.GetSource()->InSamePhase(*i_phaseShift))
-            continue;
+        m.VisitInRange(i_searchX, i_searchY, i_searchRange, [this](T* object) { return VisitObject(object); });
+        return;
+    }
 
-        if (i_check(ref.GetSource()))
-        {
-            this->Insert(ref.GetSource());
+    for (GridReference<T> const& ref : m)
+        if (!VisitObject(ref.GetSource()))
+            return;
+}
 
-            if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
-                return;
-        }
+template <class Check, class Result, class MapTypeMaskCheck>
+template <class T>
+inline bool Trinity::WorldObjectSearcherBase<Check, Result, MapTypeMaskCheck>::VisitObject(T* object)
+{
+    if (!object->InSamePhase(*i_phaseShift))
+        return true;
+
+    if (i_check(object))
+    {
+        this->Insert(object);
+
+        if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
+            return false;
     }
+
+    return true;
 }
 
 template<typename Localizer>
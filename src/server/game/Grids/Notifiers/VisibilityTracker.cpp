@@ -0,0 +1,185 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VisibilityTracker.h"
+#include "CellImpl.h"
+#include "GridNotifiers.h"
+#include "GridNotifiersImpl.h"
+#include "Map.h"
+#include "Metric.h"
+#include "Player.h"
+#include "World.h"
+#include <algorithm>
+
+namespace Trinity
+{
+CellVisibility ClassifyCell(CellCoord const& cell, float x, float y, float sightRange)
+{
+    float minX = (float(cell.x_coord) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL;
+    float minY = (float(cell.y_coord) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL;
+    float maxX = minX + SIZE_OF_GRID_CELL;
+    float maxY = minY + SIZE_OF_GRID_CELL;
+
+    float nearestX = std::max({ minX - x, 0.0f, x - maxX });
+    float nearestY = std::max({ minY - y, 0.0f, y - maxY });
+    float nearestSq = nearestX * nearestX + nearestY * nearestY;
+
+    float outsideRange = sightRange + VISIBILITY_TRACKER_MARGIN;
+    if (nearestSq > outsideRange * outsideRange)
+        return CellVisibility::Outside;
+
+    float farthestX = std::max(std::abs(x - minX), std::abs(x - maxX));
+    float farthestY = std::max(std::abs(y - minY), std::abs(y - maxY));
+    float farthestSq = farthestX * farthestX + farthestY * farthestY;
+
+    if (farthestSq <= sightRange * sightRange && nearestSq >= VISIBILITY_TRACKER_MARGIN * VISIBILITY_TRACKER_MARGIN)
+        return CellVisibility::Inside;
+
+    return CellVisibility::Partial;
+}
+
+bool VisibilityTracker::BeginPass(Map const* map, float sightRange, uint32 maxIncrementalPasses)
+{
+    _nextCells.clear();
+
+    bool incremental = _valid && _map == map && _sightRange == sightRange && _incrementalPasses < maxIncrementalPasses;
+    if (incremental)
+        ++_incrementalPasses;
+    else
+        _incrementalPasses = 0;
+
+    _map = map;
+    _sightRange = sightRange;
+    return incremental;
+}
+
+bool VisibilityTracker::CanSkip(CellState const& state) const
+{
+    if (state.Visibility == CellVisibility::Partial)
+        return false;
+
+    auto itr = std::lower_bound(_cells.begin(), _cells.end(), state.CellId, [](CellState const& cell, uint32 cellId) { return cell.CellId < cellId; });
+    return itr != _cells.end() && itr->CellId == state.CellId && itr->Version == state.Version && itr->Visibility == state.Visibility;
+}
+
+void VisibilityTracker::EndPass()
+{
+    std::swap(_cells, _nextCells);
+    _nextCells.clear();
+    _valid = true;
+}
+}
+
+namespace
+{
+struct CellVersionVisitor
+{
+    uint32 Version = 0;
+
+    template<class T> void Visit(GridRefManager<T>& m) { Version += m.GetVersion(); }
+};
+
+uint32 GetCellVersion(Map& map, Cell const& cell)
+{
+    CellVersionVisitor versionVisitor;
+    TypeContainerVisitor<CellVersionVisitor, WorldTypeMapContainer> worldVersion(versionVisitor);
+    TypeContainerVisitor<CellVersionVisitor, GridTypeMapContainer> gridVersion(versionVisitor);
+    map.Visit(cell, worldVersion);
+    map.Visit(cell, gridVersion);
+    return versionVisitor.Version;
+}
+
+template<class Notifier>
+void VisitCell(Map& map, Cell const& cell, Notifier& notifier)
+{
+    TypeContainerVisitor<Notifier, WorldTypeMapContainer> worldNotifier(notifier);
+    TypeContainerVisitor<Notifier, GridTypeMapContainer> gridNotifier(notifier);
+    map.Visit(cell, worldNotifier);
+    map.Visit(cell, gridNotifier);
+}
+
+template<class Notifier>
+void VisitObjectsForVisibilityImpl(Player& player, Notifier& notifier, float radius, bool dontLoad)
+{
+    WorldObject const* viewPoint = player.m_seer;
+    Map& map = *player.GetMap();
+    float sightRange = player.GetSightRange();
+    Trinity::VisibilityTracker& tracker = player.GetVisibilityTracker();
+
+    if (!sWorld->getBoolConfig(CONFIG_VISIBILITY_INCREMENTAL) || viewPoint != &player)
+    {
+        tracker.Invalidate();
+        Cell::VisitAllObjects(viewPoint, notifier, radius, dontLoad);
+        return;
+    }
+
+    bool incremental = tracker.BeginPass(&map, sightRange, sWorld->getIntConfig(CONFIG_VISIBILITY_INCREMENTAL_FULL_RESCAN_INTERVAL));
+
+    // same area as Cell::Visit with its object radius increase
+    CellArea area = Cell::CalculateCellArea(viewPoint->GetPositionX(), viewPoint->GetPositionY(), std::min(radius + viewPoint->GetCombatReach(), SIZE_OF_GRIDS));
+
+    notifier.i_incremental = incremental;
+    for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+    {
+        for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+        {
+            CellCoord cellCoord(x, y);
+            Cell cell(cellCoord);
+            cell.SetNoCreate();
+
+            // version is taken before visiting, objects added by the visit itself must be evaluated next time
+            Trinity::VisibilityTracker::CellState state{ cellCoord.GetId(), GetCellVersion(map, cell), Trinity::ClassifyCell(cellCoord, viewPoint->GetPositionX(), viewPoint->GetPositionY(), sightRange) };
+            if (incremental)
+            {
+                notifier.i_skipVisibility = tracker.CanSkip(state);
+                VisitCell(map, cell, notifier);
+            }
+
+            tracker.Record(state);
+        }
+    }
+
+    notifier.i_skipVisibility = false;
+
+    if (incremental)
+    {
+        // objects in cells that left the area are out of range now
+        tracker.ForEachDroppedCell([&](uint32 cellId)
+        {
+            Cell cell(CellCoord(cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP, cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP));
+            cell.SetNoCreate();
+            VisitCell(map, cell, notifier);
+        });
+    }
+    else
+        Cell::VisitAllObjects(viewPoint, notifier, radius, dontLoad);
+
+    tracker.EndPass();
+}
+}
+
+void Trinity::VisitObjectsForVisibility(Player& player, VisibleNotifier& notifier, float radius, bool dontLoad)
+{
+    TC_METRIC_HISTOGRAM_TIMER("trinity_visibility_pass_duration_seconds", "Duration of player visibility passes", "notifier=\"visible\"");
+    VisitObjectsForVisibilityImpl(player, notifier, radius, dontLoad);
+}
+
+void Trinity::VisitObjectsForVisibility(Player& player, PlayerRelocationNotifier& notifier, float radius, bool dontLoad)
+{
+    TC_METRIC_HISTOGRAM_TIMER("trinity_visibility_pass_duration_seconds", "Duration of player visibility passes", "notifier=\"relocation\"");
+    VisitObjectsForVisibilityImpl(player, notifier, radius, dontLoad);
+}
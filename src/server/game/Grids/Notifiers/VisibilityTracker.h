@@ -0,0 +1,102 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_VISIBILITY_TRACKER_H
+#define TRINITY_VISIBILITY_TRACKER_H
+
+#include "Define.h"
+#include "GridDefines.h"
+#include <vector>
+
+class Map;
+class Player;
+
+namespace Trinity
+{
+    struct VisibleNotifier;
+    struct PlayerRelocationNotifier;
+
+    // Extra distance around sight range and around the viewer within which cells are always evaluated.
+    // Covers stealth detection range (MAX_PLAYER_STEALTH_DETECT_RANGE) and combat reach of both objects
+    constexpr float VISIBILITY_TRACKER_MARGIN = 40.0f;
+
+    enum class CellVisibility : uint8
+    {
+        Partial,    // cell crosses sight range or the margin around the viewer, objects must be evaluated
+        Inside,     // whole cell is within sight range and outside the margin around the viewer
+        Outside     // whole cell is beyond sight range and its margin
+    };
+
+    TC_GAME_API CellVisibility ClassifyCell(CellCoord const& cell, float x, float y, float sightRange);
+
+    /*
+     * Remembers the cells evaluated by the last visibility pass of a player together with their
+     * membership version and their position relative to sight range.
+     * A following pass caused only by movement of the player skips cells whose membership did not
+     * change and that stayed entirely inside or entirely outside of sight range, and evaluates the
+     * cells that left the visited area instead of rescanning everything.
+     * Objects with a visibility distance override are seen from farther than sight range and are
+     * evaluated even in skipped cells.
+     * A full pass is forced after a configurable number of incremental passes.
+     */
+    class TC_GAME_API VisibilityTracker
+    {
+    public:
+        struct CellState
+        {
+            uint32 CellId;
+            uint32 Version;
+            CellVisibility Visibility;
+        };
+
+        // returns true if the pass can skip cells recorded by the previous pass
+        bool BeginPass(Map const* map, float sightRange, uint32 maxIncrementalPasses);
+        // cells must be recorded in increasing CellId order
+        void Record(CellState const& state) { _nextCells.push_back(state); }
+        bool CanSkip(CellState const& state) const;
+        void EndPass();
+
+        void Invalidate() { _valid = false; }
+
+        template<typename Visitor>
+        void ForEachDroppedCell(Visitor&& visitor) const
+        {
+            auto next = _nextCells.begin();
+            for (CellState const& state : _cells)
+            {
+                while (next != _nextCells.end() && next->CellId < state.CellId)
+                    ++next;
+
+                if (next == _nextCells.end() || next->CellId != state.CellId)
+                    visitor(state.CellId);
+            }
+        }
+
+    private:
+        std::vector<CellState> _cells;
+        std::vector<CellState> _nextCells;
+        Map const* _map = nullptr;
+        float _sightRange = 0.0f;
+        uint32 _incrementalPasses = 0;
+        bool _valid = false;
+    };
+
+    TC_GAME_API void VisitObjectsForVisibility(Player& player, VisibleNotifier& notifier, float radius, bool dontLoad);
+    TC_GAME_API void VisitObjectsForVisibility(Player& player, PlayerRelocationNotifier& notifier, float radius, bool dontLoad);
+}
+
+#endif // TRINITY_VISIBILITY_TRACKER_H
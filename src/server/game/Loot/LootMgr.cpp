@@ -29,6 +29,7 @@
 #include "Random.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
+#include "TaskGraph.h"
 #include "World.h"
 
 static constexpr Rates QualityToRate[MAX_ITEM_QUALITY] =
@@ -1463,19 +1464,29 @@ void LoadLootTemplates_Reference()
     TC_LOG_INFO("server.loading", ">> Loaded reference loot templates in {} ms", GetMSTimeDiffToNow(oldMSTime));
 }
 
-void LoadLootTables()
+void LoadLootTables(std::size_t threads /*= 1*/)
 {
-    LoadLootTemplates_Creature();
-    LoadLootTemplates_Fishing();
-    LoadLootTemplates_Gameobject();
-    LoadLootTemplates_Item();
-    LoadLootTemplates_Mail();
-    LoadLootTemplates_Milling();
-    LoadLootTemplates_Pickpocketing();
-    LoadLootTemplates_Skinning();
-    LoadLootTemplates_Disenchant();
-    LoadLootTemplates_Prospecting();
-    LoadLootTemplates_Spell();
-
-    LoadLootTemplates_Reference();
+    // each store only reads templates, quests and spells, which are loaded before
+    Trinity::TaskGraph loaders;
+    std::initializer_list<Trinity::TaskGraph::TaskId> stores =
+    {
+        loaders.AddTask("creature loot", LoadLootTemplates_Creature),
+        loaders.AddTask("fishing loot", LoadLootTemplates_Fishing),
+        loaders.AddTask("gameobject loot", LoadLootTemplates_Gameobject),
+        loaders.AddTask("item loot", LoadLootTemplates_Item),
+        loaders.AddTask("mail loot", LoadLootTemplates_Mail),
+        loaders.AddTask("milling loot", LoadLootTemplates_Milling),
+        loaders.AddTask("pickpocketing loot", LoadLootTemplates_Pickpocketing),
+        loaders.AddTask("skinning loot", LoadLootTemplates_Skinning),
+        loaders.AddTask("disenchant loot", LoadLootTemplates_Disenchant),
+        loaders.AddTask("prospecting loot", LoadLootTemplates_Prospecting),
+        loaders.AddTask("spell loot", LoadLootTemplates_Spell)
+    };
+
+    // references are checked against every other store
+    loaders.AddTask("reference loot", LoadLootTemplates_Reference, stores);
+
+    Trinity::TaskGraph::Timings timings = loaders.Run(threads);
+    TC_LOG_INFO("server.loading", ">> Loot tables loaded in {} ms ({} ms one after another) using {} threads",
+        timings.Total.count(), timings.Serial.count(), std::max<std::size_t>(threads, 1));
 }
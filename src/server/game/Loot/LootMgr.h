@@ -184,6 +184,7 @@ TC_GAME_API void LoadLootTemplates_Prospecting();
 TC_GAME_API void LoadLootTemplates_Spell();
 TC_GAME_API void LoadLootTemplates_Reference();
 
-TC_GAME_API void LoadLootTables();
+// stores are independent until references are checked, threads > 1 loads them in parallel
+TC_GAME_API void LoadLootTables(std::size_t threads = 1);
 
 #endif
@@ -19,6 +19,8 @@
 #include "DB2Stores.h"
 #include "GridDefines.h"
 #include "Log.h"
+#include "MappedFile.h"
+#include "Memory.h"
 #include <G3D/Plane.h>
 #include <G3D/Ray.h>
 
@@ -57,73 +59,80 @@ GridMap::~GridMap()
     unloadData();
 }
 
-GridMap::LoadResult GridMap::loadData(char const* filename)
+GridMap::LoadResult GridMap::loadData(char const* filename, bool memoryMapped)
 {
     // Unload old data if exist
     unloadData();
 
-    map_fileheader header;
-    // Not return error if file not found
-    FILE* in = fopen(filename, "rb");
-    if (!in)
-        return LoadResult::FileDoesNotExist;
+    if (memoryMapped)
+    {
+        _mappedFile = Trinity::MappedFile::Open(filename);
+        if (_mappedFile)
+            _fileData = _mappedFile->GetData();
+    }
 
-    if (fread(&header, sizeof(header), 1, in) != 1)
+    if (!_mappedFile)
     {
-        fclose(in);
-        return LoadResult::InvalidFile;
+        // Not return error if file not found
+        auto in = Trinity::make_unique_ptr_with_deleter<&::fclose>(fopen(filename, "rb"));
+        if (!in)
+            return LoadResult::FileDoesNotExist;
+
+        if (fseek(in.get(), 0, SEEK_END) != 0)
+            return LoadResult::InvalidFile;
+
+        long fileSize = ftell(in.get());
+        if (fileSize <= 0 || fseek(in.get(), 0, SEEK_SET) != 0)
+            return LoadResult::InvalidFile;
+
+        _fileBuffer.reset(new uint8[fileSize]);
+        if (fread(_fileBuffer.get(), fileSize, 1, in.get()) != 1)
+            return LoadResult::InvalidFile;
+
+        _fileData = { _fileBuffer.get(), std::size_t(fileSize) };
     }
 
+    map_fileheader header;
+    if (!readFileStruct(0, header))
+        return LoadResult::InvalidFile;
+
     if (header.mapMagic == MapMagic && header.versionMagic == MapVersionMagic)
     {
         // load up area data
-        if (header.areaMapOffset && !loadAreaData(in, header.areaMapOffset, header.areaMapSize))
+        if (header.areaMapOffset && !loadAreaData(header.areaMapOffset, header.areaMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map area data\n");
-            fclose(in);
             return LoadResult::InvalidFile;
         }
         // load up height data
-        if (header.heightMapOffset && !loadHeightData(in, header.heightMapOffset, header.heightMapSize))
+        if (header.heightMapOffset && !loadHeightData(header.heightMapOffset, header.heightMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map height data\n");
-            fclose(in);
             return LoadResult::InvalidFile;
         }
         // load up liquid data
-        if (header.liquidMapOffset && !loadLiquidData(in, header.liquidMapOffset, header.liquidMapSize))
+        if (header.liquidMapOffset && !loadLiquidData(header.liquidMapOffset, header.liquidMapSize))
         {
             TC_LOG_ERROR("maps", "Error loading map liquids data\n");
-            fclose(in);
             return LoadResult::InvalidFile;
         }
         // loadup holes data (if any. check header.holesOffset)
-        if (header.holesSize && !loadHolesData(in, header.holesOffset, header.holesSize))
+        if (header.holesSize && !loadHolesData(header.holesOffset, header.holesSize))
         {
             TC_LOG_ERROR("maps", "Error loading map holes data\n");
-            fclose(in);
             return LoadResult::InvalidFile;
         }
-        fclose(in);
         return LoadResult::Ok;
     }
 
     TC_LOG_ERROR("maps", "Map file '{}' is from an incompatible map version ({} v{}), {} v{} is expected. Please pull your source, recompile tools and recreate maps using the updated mapextractor, then replace your old map files with new files. If you still have problems search on forum for error TCE00018.",
         filename, std::string_view(header.mapMagic.data(), 4), header.versionMagic, std::string_view(MapMagic.data(), 4), MapVersionMagic);
-    fclose(in);
     return LoadResult::InvalidFile;
 }
 
 void GridMap::unloadData()
 {
-    delete[] _areaMap;
-    delete[] m_V9;
-    delete[] m_V8;
     delete[] _minHeightPlanes;
-    delete[] _liquidEntry;
-    delete[] _liquidFlags;
-    delete[] _liquidMap;
-    delete[] _holes;
     _areaMap = nullptr;
     m_V9 = nullptr;
     m_V8 = nullptr;
@@ -133,64 +142,91 @@ void GridMap::unloadData()
     _liquidMap  = nullptr;
     _holes = nullptr;
     _gridGetHeight = &GridMap::getHeightFromFlat;
+    _unalignedArrays.clear();
+    _fileData = { };
+    _fileBuffer.reset();
+    _mappedFile.reset();
 }
 
-bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
+template <typename T>
+bool GridMap::readFileStruct(uint32 offset, T& value) const
 {
-    map_areaHeader header;
-    fseek(in, offset, SEEK_SET);
+    if (offset > _fileData.size() || sizeof(T) > _fileData.size() - offset)
+        return false;
 
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.areaMagic != MapAreaMagic)
+    memcpy(&value, _fileData.data() + offset, sizeof(T));
+    return true;
+}
+
+template <typename T>
+bool GridMap::getFileArray(uint32 offset, std::size_t count, T const*& array)
+{
+    std::size_t size = count * sizeof(T);
+    if (offset > _fileData.size() || size > _fileData.size() - offset)
+        return false;
+
+    uint8 const* data = _fileData.data() + offset;
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0)
+    {
+        // sections are not padded by mapextractor, only misaligned arrays get a private copy
+        std::unique_ptr<uint8[]>& copy = _unalignedArrays.emplace_back(new uint8[size]);
+        memcpy(copy.get(), data, size);
+        data = copy.get();
+    }
+
+    array = reinterpret_cast<T const*>(data);
+    return true;
+}
+
+bool GridMap::loadAreaData(uint32 offset, uint32 /*size*/)
+{
+    map_areaHeader header;
+    if (!readFileStruct(offset, header) || header.areaMagic != MapAreaMagic)
         return false;
 
     _gridArea = header.gridArea;
     if (!header.flags.HasFlag(map_areaHeaderFlags::NoArea))
-    {
-        _areaMap = new uint16[16 * 16];
-        if (fread(_areaMap, sizeof(uint16), 16*16, in) != 16*16)
+        if (!getFileArray(offset + sizeof(header), 16 * 16, _areaMap))
             return false;
-    }
+
     return true;
 }
 
-bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadHeightData(uint32 offset, uint32 /*size*/)
 {
     map_heightHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.heightMagic != MapHeightMagic)
+    if (!readFileStruct(offset, header) || header.heightMagic != MapHeightMagic)
         return false;
 
+    offset += sizeof(header);
+
     _gridHeight = header.gridHeight;
     if (!header.flags.HasFlag(map_heightHeaderFlags::NoHeight))
     {
         if (header.flags.HasFlag(map_heightHeaderFlags::HeightAsInt16))
         {
-            m_uint16_V9 = new uint16 [129*129];
-            m_uint16_V8 = new uint16 [128*128];
-            if (fread(m_uint16_V9, sizeof(uint16), 129*129, in) != 129*129 ||
-                fread(m_uint16_V8, sizeof(uint16), 128*128, in) != 128*128)
+            if (!getFileArray(offset, 129 * 129, m_uint16_V9) ||
+                !getFileArray(offset + 129 * 129 * sizeof(uint16), 128 * 128, m_uint16_V8))
                 return false;
+            offset += (129 * 129 + 128 * 128) * sizeof(uint16);
             _gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
             _gridGetHeight = &GridMap::getHeightFromUint16;
         }
         else if (header.flags.HasFlag(map_heightHeaderFlags::HeightAsInt8))
         {
-            m_uint8_V9 = new uint8 [129*129];
-            m_uint8_V8 = new uint8 [128*128];
-            if (fread(m_uint8_V9, sizeof(uint8), 129*129, in) != 129*129 ||
-                fread(m_uint8_V8, sizeof(uint8), 128*128, in) != 128*128)
+            if (!getFileArray(offset, 129 * 129, m_uint8_V9) ||
+                !getFileArray(offset + 129 * 129 * sizeof(uint8), 128 * 128, m_uint8_V8))
                 return false;
+            offset += (129 * 129 + 128 * 128) * sizeof(uint8);
             _gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             _gridGetHeight = &GridMap::getHeightFromUint8;
         }
         else
         {
-            m_V9 = new float [129*129];
-            m_V8 = new float [128*128];
-            if (fread(m_V9, sizeof(float), 129*129, in) != 129*129 ||
-                fread(m_V8, sizeof(float), 128*128, in) != 128*128)
+            if (!getFileArray(offset, 129 * 129, m_V9) ||
+                !getFileArray(offset + 129 * 129 * sizeof(float), 128 * 128, m_V8))
                 return false;
+            offset += (129 * 129 + 128 * 128) * sizeof(float);
             _gridGetHeight = &GridMap::getHeightFromFloat;
         }
     }
@@ -201,8 +237,7 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         std::array<int16, 9> maxHeights;
         std::array<int16, 9> minHeights;
-        if (fread(maxHeights.data(), sizeof(int16), maxHeights.size(), in) != maxHeights.size() ||
-            fread(minHeights.data(), sizeof(int16), minHeights.size(), in) != minHeights.size())
+        if (!readFileStruct(offset, maxHeights) || !readFileStruct(offset + sizeof(maxHeights), minHeights))
             return false;
 
         static uint32 constexpr indices[8][3] =
@@ -242,14 +277,14 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     return true;
 }
 
-bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadLiquidData(uint32 offset, uint32 /*size*/)
 {
     map_liquidHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 || header.liquidMagic != MapLiquidMagic)
+    if (!readFileStruct(offset, header) || header.liquidMagic != MapLiquidMagic)
         return false;
 
+    offset += sizeof(header);
+
     _liquidGlobalEntry = header.liquidType;
     _liquidGlobalFlags = header.liquidFlags;
     _liquidOffX  = header.offsetX;
@@ -260,30 +295,27 @@ bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
 
     if (!header.flags.HasFlag(map_liquidHeaderFlags::NoType))
     {
-        _liquidEntry = new uint16[16*16];
-        if (fread(_liquidEntry, sizeof(uint16), 16*16, in) != 16*16)
+        if (!getFileArray(offset, 16 * 16, _liquidEntry))
             return false;
 
-        _liquidFlags = new map_liquidHeaderTypeFlags[16*16];
-        if (fread(_liquidFlags, sizeof(map_liquidHeaderTypeFlags), 16*16, in) != 16*16)
+        offset += 16 * 16 * sizeof(uint16);
+
+        if (!getFileArray(offset, 16 * 16, _liquidFlags))
             return false;
+
+        offset += 16 * 16 * sizeof(map_liquidHeaderTypeFlags);
     }
     if (!header.flags.HasFlag(map_liquidHeaderFlags::NoHeight))
     {
-        _liquidMap = new float[uint32(_liquidWidth) * uint32(_liquidHeight)];
-        if (fread(_liquidMap, sizeof(float), _liquidWidth*_liquidHeight, in) != (uint32(_liquidWidth) * uint32(_liquidHeight)))
+        if (!getFileArray(offset, uint32(_liquidWidth) * uint32(_liquidHeight), _liquidMap))
             return false;
     }
     return true;
 }
 
-bool GridMap::loadHolesData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadHolesData(uint32 offset, uint32 /*size*/)
 {
-    if (fseek(in, offset, SEEK_SET) != 0)
-        return false;
-
-    _holes = new uint8[16 * 16 * 8];
-    if (fread(_holes, sizeof(uint8), 16 * 16 * 8, in) != 16 * 16 * 8)
+    if (!getFileArray(offset, 16 * 16 * 8, _holes))
         return false;
 
     return true;
@@ -410,7 +442,7 @@ float GridMap::getHeightFromUint8(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint8 *V9_h1_ptr = &m_uint8_V9[x_int*128 + x_int + y_int];
+    uint8 const* V9_h1_ptr = &m_uint8_V9[x_int*128 + x_int + y_int];
     if (x+y < 1)
     {
         if (x > y)
@@ -480,7 +512,7 @@ float GridMap::getHeightFromUint16(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint16 *V9_h1_ptr = &m_uint16_V9[x_int*128 + x_int + y_int];
+    uint16 const* V9_h1_ptr = &m_uint16_V9[x_int*128 + x_int + y_int];
     if (x+y < 1)
     {
         if (x > y)
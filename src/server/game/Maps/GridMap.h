@@ -21,26 +21,29 @@
 #include "Define.h"
 #include "MapDefines.h"
 #include "Optional.h"
-#include <cstdio>
+#include <memory>
+#include <span>
+#include <vector>
 
 struct LiquidData;
 enum ZLiquidStatus : uint32;
 namespace G3D { class Plane; }
+namespace Trinity { class MappedFile; }
 
 class TC_GAME_API GridMap
 {
     uint32  _flags;
     union
     {
-        float* m_V9;
-        uint16* m_uint16_V9;
-        uint8* m_uint8_V9;
+        float const* m_V9;
+        uint16 const* m_uint16_V9;
+        uint8 const* m_uint8_V9;
     };
     union
     {
-        float* m_V8;
-        uint16* m_uint16_V8;
-        uint8* m_uint8_V8;
+        float const* m_V8;
+        uint16 const* m_uint16_V8;
+        uint8 const* m_uint8_V8;
     };
     G3D::Plane* _minHeightPlanes;
     // Height level data
@@ -48,13 +51,13 @@ class TC_GAME_API GridMap
     float _gridIntHeightMultiplier;
 
     // Area data
-    uint16* _areaMap;
+    uint16 const* _areaMap;
 
     // Liquid data
     float _liquidLevel;
-    uint16* _liquidEntry;
-    map_liquidHeaderTypeFlags* _liquidFlags;
-    float* _liquidMap;
+    uint16 const* _liquidEntry;
+    map_liquidHeaderTypeFlags const* _liquidFlags;
+    float const* _liquidMap;
     uint16 _gridArea;
     uint16 _liquidGlobalEntry;
     map_liquidHeaderTypeFlags _liquidGlobalFlags;
@@ -63,12 +66,23 @@ class TC_GAME_API GridMap
     uint8 _liquidWidth;
     uint8 _liquidHeight;
 
-    uint8* _holes;
+    uint8 const* _holes;
 
-    bool loadAreaData(FILE* in, uint32 offset, uint32 size);
-    bool loadHeightData(FILE* in, uint32 offset, uint32 size);
-    bool loadLiquidData(FILE* in, uint32 offset, uint32 size);
-    bool loadHolesData(FILE* in, uint32 offset, uint32 size);
+    // Whole file contents, arrays above point directly into it
+    std::unique_ptr<Trinity::MappedFile> _mappedFile;
+    std::unique_ptr<uint8[]> _fileBuffer;
+    std::span<uint8 const> _fileData;
+    std::vector<std::unique_ptr<uint8[]>> _unalignedArrays;
+
+    template <typename T>
+    bool readFileStruct(uint32 offset, T& value) const;
+    template <typename T>
+    bool getFileArray(uint32 offset, std::size_t count, T const*& array);
+
+    bool loadAreaData(uint32 offset, uint32 size);
+    bool loadHeightData(uint32 offset, uint32 size);
+    bool loadLiquidData(uint32 offset, uint32 size);
+    bool loadHolesData(uint32 offset, uint32 size);
     bool isHole(int row, int col) const;
 
     // Get height functions and pointers
@@ -90,7 +104,8 @@ public:
         InvalidFile
     };
 
-    LoadResult loadData(char const* filename);
+    // memoryMapped references the file in place (shared page cache) instead of reading it into private memory
+    LoadResult loadData(char const* filename, bool memoryMapped);
     void unloadData();
 
     uint16 getArea(float x, float y) const;
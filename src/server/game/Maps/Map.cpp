@@ -48,6 +48,7 @@
 #include "PhasingHandler.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "SharedWorldPacket.h"
 #include "SpellAuras.h"
 #include "TerrainMgr.h"
 #include "Transport.h"
@@ -139,7 +140,7 @@ m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
 i_gridExpiry(expiry), m_terrain(sTerrainMgr.LoadTerrain(id)), m_forceEnabledNavMeshFilterFlags(0), m_forceDisabledNavMeshFilterFlags(0),
-i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0), _vignetteUpdateTimer(5200, 5200)
+i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0), _terrainPrefetchTimer(1000, 1000), _vignetteUpdateTimer(5200, 5200)
 {
     for (uint32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
     {
@@ -304,6 +305,32 @@ void Map::EnsureGridCreated(GridCoord const& p)
     }
 }
 
+void Map::PrefetchTerrain(float x, float y)
+{
+    GridCoord p = Trinity::ComputeGridCoord(x, y);
+    if (!p.IsCoordValid() || getNGrid(p.x_coord, p.y_coord))
+        return;
+
+    sTerrainMgr.PrefetchGrid(m_terrain, (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord, (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord);
+}
+
+void Map::PrefetchTerrainAhead(Player const* player)
+{
+    // taxi flights prefetch their upcoming nodes, other players are expected to keep direction and speed
+    if (!player->IsInWorld() || player->IsInFlight() || !player->HasUnitMovementFlag(MOVEMENTFLAG_FORWARD))
+        return;
+
+    UnitMoveType moveType = MOVE_RUN;
+    if (player->IsFlying())
+        moveType = MOVE_FLIGHT;
+    else if (player->IsInWater())
+        moveType = MOVE_SWIM;
+
+    float distance = player->GetSpeed(moveType) * float(TerrainPrefetchLookahead.count());
+    float angle = player->GetOrientation();
+    PrefetchTerrain(player->GetPositionX() + std::cos(angle) * distance, player->GetPositionY() + std::sin(angle) * distance);
+}
+
 //Load NGrid and make it active
 void Map::EnsureGridLoadedForActiveObject(Cell const& cell, WorldObject const* object)
 {
@@ -766,6 +793,10 @@ void Map::Update(uint32 t_diff)
         obj->Update(t_diff);
     }
 
+    if (_terrainPrefetchTimer.Update(t_diff))
+        for (MapReference const& ref : m_mapRefManager)
+            PrefetchTerrainAhead(ref.GetSource());
+
     if (_vignetteUpdateTimer.Update(t_diff))
     {
         for (Vignettes::VignetteData* vignette : _infiniteAOIVignettes)
@@ -1046,7 +1077,9 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
     }
 
     player->UpdatePositionData();
-    player->UpdateObjectVisibility(false);
+
+    // only the position changed - keep incremental visibility state of the player valid
+    player->AddToNotify(NOTIFY_VISIBILITY_CHANGED);
 }
 
 void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail)
@@ -2669,6 +2702,7 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    WorldPacketBroadcast broadcast(*data);
     for (MapRefManager::const_iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
         itr->GetSource()->SendDirectMessage(data);
 }
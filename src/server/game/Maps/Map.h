@@ -278,6 +278,12 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void SetUnloadLock(GridCoord const& p, bool on) { getNGrid(p.x_coord, p.y_coord)->setUnloadExplicitLock(on); }
         void LoadGrid(float x, float y);
         void LoadGridForActiveObject(float x, float y, WorldObject const* object);
+
+        // starts reading terrain files of the grid in background so creating it later does not wait for the disk
+        void PrefetchTerrain(float x, float y);
+
+        // how far ahead moving players get terrain prefetched
+        static constexpr Seconds TerrainPrefetchLookahead = 15s;
         void LoadAllCells();
         bool UnloadGrid(NGridType& ngrid, bool pForce);
         void GridMarkNoUnload(uint32 x, uint32 y);
@@ -822,6 +828,9 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         uint32 _respawnCheckTimer;
         std::unordered_map<uint32, uint32> _zonePlayerCountMap;
 
+        void PrefetchTerrainAhead(Player const* player);
+        PeriodicTimer _terrainPrefetchTimer;
+
         ZoneDynamicInfoMap _zoneDynamicInfo;
         IntervalTimer _weatherUpdateTimer;
 
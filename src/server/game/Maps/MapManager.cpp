@@ -16,6 +16,7 @@
  */
 
 #include "MapManager.h"
+#include "AsyncPathfinder.h"
 #include "BattlefieldMgr.h"
 #include "Battleground.h"
 #include "BattlegroundScript.h"
@@ -55,6 +56,9 @@ void MapManager::Initialize()
     // Start mtmaps if needed.
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (uint32 pathfindingThreads = sWorld->getIntConfig(CONFIG_MAP_UPDATE_PATHFINDING_THREADS))
+        _asyncPathfinder = std::make_unique<AsyncPathfinder>(pathfindingThreads);
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -350,6 +354,10 @@ void MapManager::Update(uint32 diff)
     if (m_updater.activated())
         m_updater.wait();
 
+    // paths requested during this update are applied on the next one, navmesh tiles are only unloaded after this
+    if (_asyncPathfinder)
+        _asyncPathfinder->Wait();
+
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
 
@@ -383,6 +391,9 @@ bool MapManager::IsValidMAP(uint32 mapId)
 
 void MapManager::UnloadAll()
 {
+    // paths requested after this are calculated on the calling thread
+    _asyncPathfinder.reset();
+
     // first unload maps
     for (auto iter = i_maps.begin(); iter != i_maps.end(); ++iter)
     {
@@ -29,6 +29,7 @@
 #include <map>
 #include <shared_mutex>
 
+class AsyncPathfinder;
 class Battleground;
 class BattlegroundMap;
 class GarrisonMap;
@@ -118,6 +119,7 @@ class TC_GAME_API MapManager
         void FreeInstanceId(uint32 instanceId);
 
         MapUpdater * GetMapUpdater() { return &m_updater; }
+        AsyncPathfinder* GetAsyncPathfinder() { return _asyncPathfinder.get(); }
 
         template<typename Worker>
         void DoForAllMaps(Worker&& worker);
@@ -155,6 +157,7 @@ class TC_GAME_API MapManager
         std::unique_ptr<InstanceIds> _freeInstanceIds;
         uint32 _nextInstanceId;
         MapUpdater m_updater;
+        std::unique_ptr<AsyncPathfinder> _asyncPathfinder;
 
         // atomic op counter for active scripts amount
         std::atomic<std::size_t> _scheduledScripts;
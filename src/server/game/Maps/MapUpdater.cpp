@@ -19,71 +19,142 @@
 #include "DatabaseEnv.h"
 #include "Map.h"
 #include "Metric.h"
+#include "ObjectDefines.h"
+#include <algorithm>
+#include <numeric>
 
-#include <mutex>
+void MapUpdateQueues::Resize(size_t workerCount)
+{
+    _queues.resize(workerCount);
+    for (std::unique_ptr<WorkerQueue>& queue : _queues)
+        if (!queue)
+            queue = std::make_unique<WorkerQueue>();
+}
 
-class MapUpdateRequest
+void MapUpdateQueues::Dispatch(std::span<Microseconds const> predictedTimes)
 {
-    private:
+    std::vector<uint32> order(predictedTimes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint32 left, uint32 right)
+    {
+        return predictedTimes[left] > predictedTimes[right];
+    });
 
-        Map& m_map;
-        MapUpdater& m_updater;
-        uint32 m_diff;
+    // longest processing time first - every request goes to the worker with the least predicted work so far
+    // maps without history count as 1us so that they are spread round robin instead of piling up on the first worker
+    std::vector<Microseconds> workerLoad(_queues.size(), Microseconds::zero());
 
-    public:
+    for (uint32 requestIndex : order)
+    {
+        size_t workerIndex = std::distance(workerLoad.begin(), std::min_element(workerLoad.begin(), workerLoad.end()));
+        workerLoad[workerIndex] += std::max(predictedTimes[requestIndex], Microseconds(1));
+
+        WorkerQueue& queue = *_queues[workerIndex];
+        std::lock_guard<std::mutex> queueLock(queue.Lock);
+        queue.Requests.push_back(requestIndex);
+    }
+}
 
-        MapUpdateRequest(Map& m, MapUpdater& u, uint32 d)
-            : m_map(m), m_updater(u), m_diff(d)
+bool MapUpdateQueues::Pop(size_t workerIndex, uint32& requestIndex, bool& stolen)
+{
+    {
+        WorkerQueue& queue = *_queues[workerIndex];
+        std::lock_guard<std::mutex> queueLock(queue.Lock);
+        if (!queue.Requests.empty())
         {
+            requestIndex = queue.Requests.front();
+            queue.Requests.pop_front();
+            stolen = false;
+            return true;
         }
+    }
 
-        void call()
+    // own queue is empty, steal the cheapest request of another worker
+    for (size_t i = 1; i < _queues.size(); ++i)
+    {
+        WorkerQueue& queue = *_queues[(workerIndex + i) % _queues.size()];
+        std::lock_guard<std::mutex> queueLock(queue.Lock);
+        if (!queue.Requests.empty())
         {
-            TC_METRIC_TIMER("map_update_time_diff", TC_METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-            m_map.Update (m_diff);
-            m_updater.update_finished();
+            requestIndex = queue.Requests.back();
+            queue.Requests.pop_back();
+            stolen = true;
+            return true;
         }
-};
+    }
+
+    return false;
+}
 
 void MapUpdater::activate(size_t num_threads)
 {
+    _queues.Resize(num_threads);
+
     for (size_t i = 0; i < num_threads; ++i)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, i));
     }
 }
 
 void MapUpdater::deactivate()
 {
-    _cancelationToken = true;
-
     wait();
 
-    _queue.Cancel();
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _cancelationToken = true;
+    }
+
+    _workCondition.notify_all();
 
     for (auto& thread : _workerThreads)
     {
         thread.join();
     }
+
+    _workerThreads.clear();
+    _queues.Resize(0);
 }
 
 void MapUpdater::wait()
 {
+    dispatch();
+
     std::unique_lock<std::mutex> lock(_lock);
 
     while (pending_requests > 0)
         _condition.wait(lock);
 
     lock.unlock();
+
+    if (_requests.empty())
+        return;
+
+    // Maps that were not updated this tick no longer exist, rebuild the prediction table from scratch
+    _predictedUpdateTimes.clear();
+    for (MapUpdateRequest const& request : _requests)
+    {
+        Microseconds predicted = request.UpdateTime;
+        if (request.PredictedTime != Microseconds::zero())
+            predicted = (request.PredictedTime * 3 + request.UpdateTime) / 4;
+
+        _predictedUpdateTimes[MAKE_PAIR64(request.UpdatedMap->GetId(), request.UpdatedMap->GetInstanceId())] = predicted;
+    }
+
+    TC_METRIC_VALUE("map_updater_stolen_requests", _stolenRequests.exchange(0));
+
+    _requests.clear();
 }
 
 void MapUpdater::schedule_update(Map& map, uint32 diff)
 {
-    std::lock_guard<std::mutex> lock(_lock);
-
-    ++pending_requests;
+    MapUpdateRequest& request = _requests.emplace_back();
+    request.UpdatedMap = &map;
+    request.Diff = diff;
 
-    _queue.Push(new MapUpdateRequest(map, *this, diff));
+    auto itr = _predictedUpdateTimes.find(MAKE_PAIR64(map.GetId(), map.GetInstanceId()));
+    if (itr != _predictedUpdateTimes.end())
+        request.PredictedTime = itr->second;
 }
 
 bool MapUpdater::activated()
@@ -91,6 +162,25 @@ bool MapUpdater::activated()
     return _workerThreads.size() > 0;
 }
 
+void MapUpdater::dispatch()
+{
+    if (_requests.empty())
+        return;
+
+    std::vector<Microseconds> predictedTimes(_requests.size());
+    std::ranges::transform(_requests, predictedTimes.begin(), &MapUpdateRequest::PredictedTime);
+
+    std::lock_guard<std::mutex> lock(_lock);
+
+    pending_requests += _requests.size();
+
+    _queues.Dispatch(predictedTimes);
+
+    _queuedRequests += _requests.size();
+
+    _workCondition.notify_all();
+}
+
 void MapUpdater::update_finished()
 {
     std::lock_guard<std::mutex> lock(_lock);
@@ -100,7 +190,7 @@ void MapUpdater::update_finished()
     _condition.notify_all();
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::WorkerThread(size_t workerIndex)
 {
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
@@ -109,15 +199,38 @@ void MapUpdater::WorkerThread()
 
     while (1)
     {
-        MapUpdateRequest* request = nullptr;
+        uint32 requestIndex = 0;
+        bool stolen = false;
+        if (!_queues.Pop(workerIndex, requestIndex, stolen))
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            while (_queuedRequests == 0 && !_cancelationToken)
+                _workCondition.wait(lock);
+
+            if (_cancelationToken)
+                return;
 
-        _queue.WaitAndPop(request);
+            continue;
+        }
+
+        --_queuedRequests;
+        if (stolen)
+            ++_stolenRequests;
+
+        MapUpdateRequest& request = _requests[requestIndex];
+        TimePoint start = std::chrono::steady_clock::now();
+
+        {
+            TC_METRIC_TIMER("map_update_time_diff", TC_METRIC_TAG("map_id", std::to_string(request.UpdatedMap->GetId())));
+            request.UpdatedMap->Update(request.Diff);
+        }
 
-        if (_cancelationToken)
-            return;
+        request.UpdateTime = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start);
 
-        request->call();
+        static Trinity::Metrics::Histogram& mapUpdateDuration = sMetricsRegistry->GetHistogram("trinity_map_update_duration_seconds", "Duration of single map updates");
+        mapUpdateDuration.Record(request.UpdateTime);
 
-        delete request;
+        update_finished();
     }
 }
@@ -19,23 +19,72 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
+#include "Duration.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <thread>
-#include <condition_variable>
-#include "ProducerConsumerQueue.h"
+#include <unordered_map>
+#include <vector>
 
-class MapUpdateRequest;
 class Map;
 
+struct MapUpdateRequest
+{
+    Map* UpdatedMap = nullptr;
+    uint32 Diff = 0;
+    Microseconds PredictedTime = Microseconds::zero();
+    Microseconds UpdateTime = Microseconds::zero();
+};
+
+/*
+ * Per worker queues of request indexes for one tick.
+ *
+ * Requests are distributed longest-first, each onto the worker with the least predicted
+ * work so far. A worker that runs out of work steals the cheapest pending request of another
+ * worker so that a single expensive map never ends up queued last.
+ */
+class TC_GAME_API MapUpdateQueues
+{
+    public:
+
+        void Resize(size_t workerCount);
+
+        size_t GetWorkerCount() const { return _queues.size(); }
+
+        // queues requests 0..predictedTimes.size()-1
+        void Dispatch(std::span<Microseconds const> predictedTimes);
+
+        // own queue is served front to back (most expensive first), stealing takes from the back of other queues
+        bool Pop(size_t workerIndex, uint32& requestIndex, bool& stolen);
+
+    private:
+
+        struct WorkerQueue
+        {
+            std::mutex Lock;
+            std::deque<uint32> Requests;    // most expensive first
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> _queues;
+};
+
+/*
+ * Updates maps on a pool of worker threads.
+ *
+ * Requests scheduled during a tick are only handed out to workers in wait(), ordered by
+ * their predicted update time (smoothed from previous ticks), see MapUpdateQueues.
+ */
 class TC_GAME_API MapUpdater
 {
     public:
 
-        MapUpdater() : _cancelationToken(false), pending_requests(0) {}
+        MapUpdater() : _cancelationToken(false), _queuedRequests(0), _stolenRequests(0), pending_requests(0) {}
         ~MapUpdater() { };
 
-        friend class MapUpdateRequest;
-
         void schedule_update(Map& map, uint32 diff);
 
         void wait();
@@ -48,18 +97,25 @@ class TC_GAME_API MapUpdater
 
     private:
 
-        ProducerConsumerQueue<MapUpdateRequest*> _queue;
+        // only accessed by the thread calling schedule_update/wait and by workers through their queues
+        std::vector<MapUpdateRequest> _requests;
+        std::unordered_map<uint64, Microseconds> _predictedUpdateTimes;
+        MapUpdateQueues _queues;
 
         std::vector<std::thread> _workerThreads;
         std::atomic<bool> _cancelationToken;
+        std::atomic<size_t> _queuedRequests;
+        std::atomic<uint32> _stolenRequests;
 
         std::mutex _lock;
         std::condition_variable _condition;
+        std::condition_variable _workCondition;
         size_t pending_requests;
 
+        void dispatch();
         void update_finished();
 
-        void WorkerThread();
+        void WorkerThread(size_t workerIndex);
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
@@ -21,11 +21,14 @@
 #include "DynamicTree.h"
 #include "GridMap.h"
 #include "Log.h"
+#include "MappedFile.h"
 #include "Memory.h"
+#include "Metric.h"
 #include "MMapFactory.h"
 #include "PhasingHandler.h"
 #include "Random.h"
 #include "ScriptMgr.h"
+#include "ThreadPool.h"
 #include "Util.h"
 #include "VMapFactory.h"
 #include "VMapManager2.h"
@@ -160,7 +163,14 @@ void TerrainInfo::LoadMapAndVMap(int32 gx, int32 gy)
         return;
 
     std::lock_guard<std::mutex> lock(_loadMutex);
+
+    TimePoint start = std::chrono::steady_clock::now();
+    bool prefetched = _prefetchedGrids[gx][gy].exchange(false);
     LoadMapAndVMapImpl(gx, gy);
+
+    TC_METRIC_VALUE("terrain_grid_load_time", std::chrono::steady_clock::now() - start,
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("type", prefetched ? "prefetched" : "cold"));
 }
 
 void TerrainInfo::LoadMMapInstance(uint32 mapId, uint32 instanceId)
@@ -171,6 +181,24 @@ void TerrainInfo::LoadMMapInstance(uint32 mapId, uint32 instanceId)
         childTerrain->LoadMMapInstanceImpl(mapId, instanceId);
 }
 
+bool TerrainInfo::QueuePrefetch(int32 gx, int32 gy)
+{
+    if (_referenceCountFromMap[gx][gy] || _loadedGrids[gx][gy])
+        return false;
+
+    return !_prefetchedGrids[gx][gy].exchange(true);
+}
+
+void TerrainInfo::PrefetchGridFiles(int32 gx, int32 gy)
+{
+    TimePoint start = std::chrono::steady_clock::now();
+    PrefetchGridFilesImpl(gx, gy);
+
+    TC_METRIC_VALUE("terrain_grid_load_time", std::chrono::steady_clock::now() - start,
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("type", "prefetch"));
+}
+
 void TerrainInfo::LoadMapAndVMapImpl(int32 gx, int32 gy)
 {
     LoadMap(gx, gy);
@@ -180,7 +208,20 @@ void TerrainInfo::LoadMapAndVMapImpl(int32 gx, int32 gy)
     for (std::shared_ptr<TerrainInfo> const& childTerrain : _childTerrain)
         childTerrain->LoadMapAndVMapImpl(gx, gy);
 
-    _loadedGrids[GetBitsetIndex(gx, gy)] = true;
+    _loadedGrids[gx][gy] = true;
+}
+
+void TerrainInfo::PrefetchGridFilesImpl(int32 gx, int32 gy)
+{
+    // only file contents are read here, grid structures are still built by map threads
+    std::string const& dataPath = sWorld->GetDataPath();
+    Trinity::MappedFile::Prefetch(Trinity::StringFormat("{}maps/{:04}_{:02}_{:02}.map", dataPath, GetId(), gx, gy).c_str());
+    VMAP::VMapFactory::createOrGetVMapManager()->prefetchMap((dataPath + "vmaps").c_str(), GetId(), gx, gy);
+    if (DisableMgr::IsPathfindingEnabled(GetId()))
+        MMAP::MMapFactory::createOrGetMMapManager()->prefetchMap(dataPath, GetId(), gx, gy);
+
+    for (std::shared_ptr<TerrainInfo> const& childTerrain : _childTerrain)
+        childTerrain->PrefetchGridFilesImpl(gx, gy);
 }
 
 void TerrainInfo::LoadMMapInstanceImpl(uint32 mapId, uint32 instanceId)
@@ -201,7 +242,7 @@ void TerrainInfo::LoadMap(int32 gx, int32 gy)
     TC_LOG_DEBUG("maps", "Loading map {}", fileName);
     // loading data
     std::unique_ptr<GridMap> gridMap = std::make_unique<GridMap>();
-    GridMap::LoadResult gridMapLoadResult = gridMap->loadData(fileName.c_str());
+    GridMap::LoadResult gridMapLoadResult = gridMap->loadData(fileName.c_str(), sWorld->getBoolConfig(CONFIG_MEMORY_MAPPED_MAP_FILES));
     if (gridMapLoadResult == GridMap::LoadResult::Ok)
         _gridMap[gx][gy] = std::move(gridMap);
     else
@@ -270,7 +311,7 @@ void TerrainInfo::UnloadMapImpl(int32 gx, int32 gy)
     for (std::shared_ptr<TerrainInfo> const& childTerrain : _childTerrain)
         childTerrain->UnloadMapImpl(gx, gy);
 
-    _loadedGrids[GetBitsetIndex(gx, gy)] = false;
+    _loadedGrids[gx][gy] = false;
 }
 
 void TerrainInfo::UnloadMMapInstanceImpl(uint32 mapId, uint32 instanceId)
@@ -285,7 +326,7 @@ GridMap* TerrainInfo::GetGrid(uint32 mapId, float x, float y, bool loadIfMissing
     int32 gy = (int)(CENTER_GRID_ID - y / SIZE_OF_GRIDS);                   //grid y
 
     // ensure GridMap is loaded
-    if (!_loadedGrids[GetBitsetIndex(gx, gy)] && loadIfMissing)
+    if (!_loadedGrids[gx][gy] && loadIfMissing)
     {
         std::lock_guard<std::mutex> lock(_loadMutex);
         LoadMapAndVMapImpl(gx, gy);
@@ -310,10 +351,17 @@ void TerrainInfo::CleanUpGrids(uint32 diff)
 
     // delete those GridMap objects which have refcount = 0
     for (int32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+    {
         for (int32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
-            if (_loadedGrids[GetBitsetIndex(x, y)] && !_referenceCountFromMap[x][y])
+        {
+            if (_loadedGrids[x][y] && !_referenceCountFromMap[x][y])
                 UnloadMapImpl(x, y);
 
+            // files of grids nobody came to may be evicted from page cache by now
+            _prefetchedGrids[x][y] = false;
+        }
+    }
+
     _cleanupTimer.Reset(CleanupInterval);
 }
 
@@ -813,11 +861,44 @@ std::shared_ptr<TerrainInfo> TerrainMgr::LoadTerrain(uint32 mapId)
 
 void TerrainMgr::UnloadAll()
 {
+    if (_prefetchPool)
+    {
+        _prefetchPool->Join();
+        _prefetchPool = nullptr;
+    }
+
+    _prefetchedTerrains.clear();
     _terrainMaps.clear();
 }
 
+void TerrainMgr::InitializePrefetch(uint32 threadCount)
+{
+    if (threadCount)
+        _prefetchPool = std::make_unique<Trinity::ThreadPool>(threadCount);
+}
+
+void TerrainMgr::PrefetchGrid(std::shared_ptr<TerrainInfo> const& terrain, int32 gx, int32 gy)
+{
+    if (!_prefetchPool || !terrain->QueuePrefetch(gx, gy))
+        return;
+
+    _prefetchPool->PostWork([this, terrain, gx, gy]() mutable
+    {
+        terrain->PrefetchGridFiles(gx, gy);
+
+        std::lock_guard<std::mutex> lock(_prefetchedTerrainsLock);
+        _prefetchedTerrains.push_back(std::move(terrain));
+    });
+}
+
 void TerrainMgr::Update(uint32 diff)
 {
+    std::vector<std::shared_ptr<TerrainInfo>> prefetchedTerrains;
+    {
+        std::lock_guard<std::mutex> lock(_prefetchedTerrainsLock);
+        prefetchedTerrains.swap(_prefetchedTerrains);
+    }
+
     // global garbage collection
     for (auto& [mapId, terrainRef] : _terrainMaps)
         if (std::shared_ptr<TerrainInfo> terrain = terrainRef.lock())
@@ -34,6 +34,11 @@ class DynamicMapTree;
 class GridMap;
 class PhaseShift;
 
+namespace Trinity
+{
+class ThreadPool;
+}
+
 class TC_GAME_API TerrainInfo
 {
 public:
@@ -58,9 +63,16 @@ public:
     void LoadMapAndVMap(int32 gx, int32 gy);
     void LoadMMapInstance(uint32 mapId, uint32 instanceId);
 
+    // returns false if the grid is already loaded or was prefetched recently
+    bool QueuePrefetch(int32 gx, int32 gy);
+
+    // reads map, vmap and mmap tile files into the OS page cache, safe to call from any thread
+    void PrefetchGridFiles(int32 gx, int32 gy);
+
 private:
     void LoadMapAndVMapImpl(int32 gx, int32 gy);
     void LoadMMapInstanceImpl(uint32 mapId, uint32 instanceId);
+    void PrefetchGridFilesImpl(int32 gx, int32 gy);
     void LoadMap(int32 gx, int32 gy);
     void LoadVMap(int32 gx, int32 gy);
     void LoadMMap(int32 gx, int32 gy);
@@ -111,7 +123,8 @@ private:
     std::mutex _loadMutex;
     std::unique_ptr<GridMap> _gridMap[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
     std::atomic<uint16> _referenceCountFromMap[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
-    std::bitset<MAX_NUMBER_OF_GRIDS* MAX_NUMBER_OF_GRIDS> _loadedGrids;
+    std::atomic<bool> _prefetchedGrids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];     // files read ahead of first map reference since last cleanup
+    std::atomic<bool> _loadedGrids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];         // written under _loadMutex, read without it by map and prefetch threads
     std::bitset<MAX_NUMBER_OF_GRIDS* MAX_NUMBER_OF_GRIDS> _gridFileExists; // cache what grids are available for this map (not including parent/child maps)
 
     static constexpr Milliseconds CleanupInterval = 1min;
@@ -137,6 +150,10 @@ public:
     std::shared_ptr<TerrainInfo> LoadTerrain(uint32 mapId);
     void UnloadAll();
 
+    // grids are only prefetched when threadCount is not 0
+    void InitializePrefetch(uint32 threadCount);
+    void PrefetchGrid(std::shared_ptr<TerrainInfo> const& terrain, int32 gx, int32 gy);
+
     void Update(uint32 diff);
 
     uint32 GetAreaId(PhaseShift const& phaseShift, uint32 mapid, float x, float y, float z);
@@ -160,6 +177,12 @@ private:
 
     // parent map links
     std::unordered_map<uint32, std::vector<uint32>> _parentMapData;
+
+    std::unique_ptr<Trinity::ThreadPool> _prefetchPool;
+
+    // released by Update, last reference to a terrain must not be dropped by prefetch threads
+    std::mutex _prefetchedTerrainsLock;
+    std::vector<std::shared_ptr<TerrainInfo>> _prefetchedTerrains;
 };
 
 #define sTerrainMgr TerrainMgr::Instance()
@@ -0,0 +1,148 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AsyncPathfinder.h"
+#include "DetourNavMeshQuery.h"
+#include "Log.h"
+#include "MMapManager.h"
+#include "Metric.h"
+#include "PathGenerator.h"
+#include <unordered_map>
+
+namespace
+{
+struct NavMeshQueryDeleter
+{
+    void operator()(dtNavMeshQuery* query) const { dtFreeNavMeshQuery(query); }
+};
+
+struct WorkerNavMeshQuery
+{
+    std::weak_ptr<MMAP::MMapData> NavMeshData;
+    std::unique_ptr<dtNavMeshQuery, NavMeshQueryDeleter> Query;
+};
+}
+
+AsyncPathfinder::AsyncPathfinder(uint32 threadCount) : _pendingPaths(0), _calculatedPaths(0), _sharedQueryPaths(0), _stopping(false)
+{
+    for (uint32 i = 0; i < threadCount; ++i)
+        _workerThreads.emplace_back(&AsyncPathfinder::WorkerThread, this);
+}
+
+AsyncPathfinder::~AsyncPathfinder()
+{
+    Wait();
+
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _stopping = true;
+    }
+
+    _workCondition.notify_all();
+
+    for (std::thread& thread : _workerThreads)
+        thread.join();
+}
+
+void AsyncPathfinder::Enqueue(std::shared_ptr<PathGenerator> path)
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _queue.push_back(std::move(path));
+        ++_pendingPaths;
+    }
+
+    _workCondition.notify_one();
+}
+
+void AsyncPathfinder::Wait()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _finishedCondition.wait(lock, [this] { return _pendingPaths == 0; });
+
+    uint32 calculatedPaths = std::exchange(_calculatedPaths, 0);
+    uint32 sharedQueryPaths = std::exchange(_sharedQueryPaths, 0);
+    lock.unlock();
+
+    TC_METRIC_VALUE("pathfinding_async_paths", calculatedPaths);
+    TC_METRIC_VALUE("pathfinding_shared_query_paths", sharedQueryPaths);
+}
+
+void AsyncPathfinder::WorkerThread()
+{
+    std::unordered_map<MMAP::MMapData const*, WorkerNavMeshQuery> navMeshQueries;
+    std::vector<std::shared_ptr<PathGenerator>> batch;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _workCondition.wait(lock, [this] { return _stopping || !_queue.empty(); });
+            if (_queue.empty())
+                return;
+
+            batch.push_back(std::move(_queue.front()));
+            _queue.pop_front();
+
+            // take every other path that can share queries with the first one
+            std::erase_if(_queue, [&](std::shared_ptr<PathGenerator>& path)
+            {
+                if (!batch.front()->CanShareQueryWith(*path))
+                    return false;
+
+                batch.push_back(std::move(path));
+                return true;
+            });
+        }
+
+        // drop queries of unloaded navmeshes, the batch keeps its own alive so a new navmesh at a reused address is never matched with a stale query
+        std::erase_if(navMeshQueries, [](std::pair<MMAP::MMapData const* const, WorkerNavMeshQuery> const& query) { return query.second.NavMeshData.expired(); });
+
+        std::shared_ptr<MMAP::MMapData> const& navMeshData = batch.front()->_navMeshData;
+        auto [queryItr, inserted] = navMeshQueries.try_emplace(navMeshData.get());
+        if (inserted)
+        {
+            queryItr->second.NavMeshData = navMeshData;
+            queryItr->second.Query.reset(dtAllocNavMeshQuery());
+            if (dtStatusFailed(queryItr->second.Query->init(navMeshData->navMesh, 1024)))
+            {
+                TC_LOG_ERROR("maps.mmaps", "AsyncPathfinder: Failed to initialize dtNavMeshQuery");
+                navMeshQueries.erase(queryItr);
+                queryItr = navMeshQueries.end();
+            }
+        }
+
+        {
+            std::shared_lock<std::shared_mutex> navMeshLock(navMeshData->tileLock);
+            PathGenerator::QueryCache cache;
+            for (std::shared_ptr<PathGenerator> const& path : batch)
+                path->BuildDetachedPath(queryItr != navMeshQueries.end() ? queryItr->second.Query.get() : nullptr, cache);
+        }
+
+        std::size_t batchSize = batch.size();
+        batch.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _calculatedPaths += batchSize;
+            _sharedQueryPaths += batchSize - 1;
+            _pendingPaths -= batchSize;
+            if (!_pendingPaths)
+                _finishedCondition.notify_all();
+        }
+    }
+}
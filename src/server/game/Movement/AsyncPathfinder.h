@@ -0,0 +1,67 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_ASYNC_PATHFINDER_H
+#define TRINITYCORE_ASYNC_PATHFINDER_H
+
+#include "Define.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class PathGenerator;
+
+/*
+ * Calculates paths requested with PathGenerator::CalculatePathAsync on a pool of threads.
+ * Workers run Detour queries on detached copies of path generators, with a dtNavMeshQuery owned
+ * by each worker. Queued paths with the same destination, filter and options are taken together
+ * and share the destination lookup and the corridor of paths starting on the same polygon, so
+ * packs chasing one target cost little more than a single creature.
+ * MapManager waits for the queue after each map update, results are applied on the next one.
+ */
+class TC_GAME_API AsyncPathfinder
+{
+public:
+    explicit AsyncPathfinder(uint32 threadCount);
+    ~AsyncPathfinder();
+
+    AsyncPathfinder(AsyncPathfinder const&) = delete;
+    AsyncPathfinder& operator=(AsyncPathfinder const&) = delete;
+
+    void Enqueue(std::shared_ptr<PathGenerator> path);
+
+    // Blocks until every queued path is calculated
+    void Wait();
+
+private:
+    void WorkerThread();
+
+    std::vector<std::thread> _workerThreads;
+    std::deque<std::shared_ptr<PathGenerator>> _queue;
+    std::mutex _lock;
+    std::condition_variable _workCondition;
+    std::condition_variable _finishedCondition;
+    std::size_t _pendingPaths;
+    uint32 _calculatedPaths;
+    uint32 _sharedQueryPaths;
+    bool _stopping;
+};
+
+#endif // TRINITYCORE_ASYNC_PATHFINDER_H
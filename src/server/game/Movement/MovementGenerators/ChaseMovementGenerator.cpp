@@ -122,6 +122,15 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
         if (cOwner->IsIgnoringChaseRange())
             minRange = minTarget = maxRange = maxTarget = 0.0f;
 
+    // path requested on a previous update
+    if (_path && _path->IsCalculatingAsync())
+    {
+        if (!_path->UpdateAsyncPath())
+            return true;
+
+        LaunchMovement(owner, target, maxTarget);
+    }
+
     // periodically check if we're already in the expected range...
     _rangeCheckTimer.Update(diff);
     if (_rangeCheckTimer.Passed())
@@ -195,8 +204,10 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
             if (owner->IsHovering())
                 owner->UpdateAllowedPositionZ(x, y, z);
 
-            bool success = _path->CalculatePath(x, y, z, owner->CanFly());
-            if (!success || (_path->GetPathType() & (PATHFIND_NOPATH /* | PATHFIND_INCOMPLETE*/)))
+            _shortenPath = shortenPath;
+
+            bool success = _path->CalculatePathAsync(x, y, z, owner->CanFly());
+            if (!success)
             {
                 if (cOwner)
                     cOwner->SetCannotReachTarget(true);
@@ -204,41 +215,57 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
                 return true;
             }
 
-            if (shortenPath)
-                _path->ShortenPathUntilDist(PositionToVector3(target), maxTarget);
+            // otherwise movement starts once the path is ready
+            if (!_path->IsCalculatingAsync())
+                LaunchMovement(owner, target, maxTarget);
+        }
+    }
 
-            if (cOwner)
-                cOwner->SetCannotReachTarget(false);
+    // and then, finally, we're done for the tick
+    return true;
+}
 
-            bool walk = false;
-            if (cOwner && !cOwner->IsPet())
-            {
-                switch (cOwner->GetMovementTemplate().GetChase())
-                {
-                    case CreatureChaseMovementType::CanWalk:
-                        walk = owner->IsWalking();
-                        break;
-                    case CreatureChaseMovementType::AlwaysWalk:
-                        walk = true;
-                        break;
-                    default:
-                        break;
-                }
-            }
+void ChaseMovementGenerator::LaunchMovement(Unit* owner, Unit* target, float maxTarget)
+{
+    Creature* const cOwner = owner->ToCreature();
+    if (_path->GetPathType() & (PATHFIND_NOPATH /* | PATHFIND_INCOMPLETE*/))
+    {
+        if (cOwner)
+            cOwner->SetCannotReachTarget(true);
+        owner->StopMoving();
+        return;
+    }
 
-            owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
-            AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+    if (_shortenPath)
+        _path->ShortenPathUntilDist(PositionToVector3(target), maxTarget);
 
-            Movement::MoveSplineInit init(owner);
-            init.MovebyPath(_path->GetPath());
-            init.SetWalk(walk);
-            init.SetFacing(target);
-            init.Launch();
+    if (cOwner)
+        cOwner->SetCannotReachTarget(false);
+
+    bool walk = false;
+    if (cOwner && !cOwner->IsPet())
+    {
+        switch (cOwner->GetMovementTemplate().GetChase())
+        {
+            case CreatureChaseMovementType::CanWalk:
+                walk = owner->IsWalking();
+                break;
+            case CreatureChaseMovementType::AlwaysWalk:
+                walk = true;
+                break;
+            default:
+                break;
         }
     }
 
-    // and then, finally, we're done for the tick
-    return true;
+    owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
+    AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(_path->GetPath());
+    init.SetWalk(walk);
+    init.SetFacing(target);
+    init.Launch();
 }
 
 void ChaseMovementGenerator::Deactivate(Unit* owner)
@@ -25,6 +25,7 @@
 #include "MoveSplineInit.h"
 #include "ObjectMgr.h"
 #include "Player.h"
+#include <cmath>
 #include <sstream>
 
 #define FLIGHT_TRAVEL_UPDATE 100
@@ -138,6 +139,8 @@ bool FlightPathMovementGenerator::DoUpdate(Player* owner, uint32 /*diff*/)
             _currentNode += departureEvent ? 1 : 0;
             departureEvent = !departureEvent;
         } while (_currentNode < _path.size() - 1);
+
+        PrefetchTerrainAhead(owner);
     }
 
     if (_currentNode >= (_path.size() - 1))
@@ -317,6 +320,26 @@ void FlightPathMovementGenerator::PreloadEndGrid(Player* owner)
         TC_LOG_DEBUG("movement.flightpath", "FlightPathMovementGenerator::PreloadEndGrid: unable to determine map to preload flightmaster grid");
 }
 
+void FlightPathMovementGenerator::PrefetchTerrainAhead(Player* owner) const
+{
+    if (_currentNode >= _path.size())
+        return;
+
+    // terrain under the nodes reached within the lookahead time is loaded before the grids are created
+    float const lookaheadDistance = _speed.value_or(PLAYER_FLIGHT_SPEED) * float(Map::TerrainPrefetchLookahead.count());
+    float distance = 0.0f;
+    for (size_t i = _currentNode + 1; i < _path.size() && distance < lookaheadDistance; ++i)
+    {
+        TaxiPathNodeEntry const* previous = _path[i - 1];
+        TaxiPathNodeEntry const* node = _path[i];
+        if (node->ContinentID != owner->GetMapId())
+            break;
+
+        distance += std::hypot(node->Loc.X - previous->Loc.X, node->Loc.Y - previous->Loc.Y);
+        owner->GetMap()->PrefetchTerrain(node->Loc.X, node->Loc.Y);
+    }
+}
+
 uint32 FlightPathMovementGenerator::GetPathId(size_t index) const
 {
     if (index >= _path.size())
@@ -56,6 +56,7 @@ class FlightPathMovementGenerator : public MovementGeneratorMedium<Player, Fligh
         void DoEventIfAny(Player* owner, TaxiPathNodeEntry const* node, bool departure);
         void InitEndGridInfo();
         void PreloadEndGrid(Player* owner);
+        void PrefetchTerrainAhead(Player* owner) const;
 
         std::string GetDebugInfo() const override;
 
@@ -23,6 +23,7 @@
 #include "MovementDefines.h"
 #include "MoveSpline.h"
 #include "MoveSplineInit.h"
+#include "PathGenerator.h"
 #include "Vehicle.h"
 
 template<class T>
@@ -36,6 +37,11 @@ HomeMovementGenerator<T>::HomeMovementGenerator()
 
 template HomeMovementGenerator<Creature>::HomeMovementGenerator();
 
+template<class T>
+HomeMovementGenerator<T>::~HomeMovementGenerator() = default;
+
+template HomeMovementGenerator<Creature>::~HomeMovementGenerator();
+
 template<class T>
 MovementGeneratorType HomeMovementGenerator<T>::GetMovementGeneratorType() const
 {
@@ -45,21 +51,11 @@ MovementGeneratorType HomeMovementGenerator<T>::GetMovementGeneratorType() const
 template MovementGeneratorType HomeMovementGenerator<Creature>::GetMovementGeneratorType() const;
 
 template<class T>
-void HomeMovementGenerator<T>::SetTargetLocation(T*) { }
+void HomeMovementGenerator<T>::LaunchMovement(T*) { }
 
 template<>
-void HomeMovementGenerator<Creature>::SetTargetLocation(Creature* owner)
+void HomeMovementGenerator<Creature>::LaunchMovement(Creature* owner)
 {
-    // if we are ROOT/STUNNED/DISTRACTED even after aura clear, finalize on next update - otherwise we would get stuck in evade
-    if (owner->HasUnitState(UNIT_STATE_ROOT | UNIT_STATE_STUNNED | UNIT_STATE_DISTRACTED))
-    {
-        AddFlag(MOVEMENTGENERATOR_FLAG_INTERRUPTED);
-        return;
-    }
-
-    owner->ClearUnitState(UNIT_STATE_ALL_ERASABLE & ~UNIT_STATE_EVADE);
-    owner->AddUnitState(UNIT_STATE_ROAMING_MOVE);
-
     Position destination = owner->GetHomePosition();
     Movement::MoveSplineInit init(owner);
 
@@ -74,12 +70,45 @@ void HomeMovementGenerator<Creature>::SetTargetLocation(Creature* owner)
      */
 
     owner->UpdateAllowedPositionZ(destination.m_positionX, destination.m_positionY, destination.m_positionZ);
-    init.MoveTo(PositionToVector3(destination));
+    if (_path->GetPathType() != PATHFIND_BLANK && !(_path->GetPathType() & PATHFIND_NOPATH))
+        init.MovebyPath(_path->GetPath());
+    else
+        init.MoveTo(PositionToVector3(destination), false);
+
+    _path = nullptr;
+
     init.SetFacing(destination.GetOrientation());
     init.SetWalk(false);
     init.Launch();
 }
 
+template<class T>
+void HomeMovementGenerator<T>::SetTargetLocation(T*) { }
+
+template<>
+void HomeMovementGenerator<Creature>::SetTargetLocation(Creature* owner)
+{
+    // if we are ROOT/STUNNED/DISTRACTED even after aura clear, finalize on next update - otherwise we would get stuck in evade
+    if (owner->HasUnitState(UNIT_STATE_ROOT | UNIT_STATE_STUNNED | UNIT_STATE_DISTRACTED))
+    {
+        AddFlag(MOVEMENTGENERATOR_FLAG_INTERRUPTED);
+        return;
+    }
+
+    owner->ClearUnitState(UNIT_STATE_ALL_ERASABLE & ~UNIT_STATE_EVADE);
+    owner->AddUnitState(UNIT_STATE_ROAMING_MOVE);
+
+    Position destination = owner->GetHomePosition();
+    owner->UpdateAllowedPositionZ(destination.m_positionX, destination.m_positionY, destination.m_positionZ);
+
+    _path = std::make_unique<PathGenerator>(owner);
+    _path->CalculatePathAsync(destination.m_positionX, destination.m_positionY, destination.m_positionZ);
+
+    // otherwise movement starts once the path is ready
+    if (!_path->IsCalculatingAsync())
+        LaunchMovement(owner);
+}
+
 template<class T>
 void HomeMovementGenerator<T>::DoInitialize(T*) { }
 
@@ -114,6 +143,15 @@ bool HomeMovementGenerator<T>::DoUpdate(T*, uint32)
 template<>
 bool HomeMovementGenerator<Creature>::DoUpdate(Creature* owner, uint32 /*diff*/)
 {
+    // path requested by SetTargetLocation
+    if (_path)
+    {
+        if (!_path->UpdateAsyncPath())
+            return true;
+
+        LaunchMovement(owner);
+    }
+
     if (HasFlag(MOVEMENTGENERATOR_FLAG_INTERRUPTED) || owner->movespline->Finalized())
     {
         AddFlag(MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
@@ -130,6 +168,7 @@ void HomeMovementGenerator<Creature>::DoDeactivate(Creature* owner)
 {
     AddFlag(MOVEMENTGENERATOR_FLAG_DEACTIVATED);
     owner->ClearUnitState(UNIT_STATE_ROAMING_MOVE);
+    _path = nullptr;
 }
 
 template<class T>
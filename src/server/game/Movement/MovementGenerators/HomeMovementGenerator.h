@@ -20,11 +20,14 @@
 
 #include "MovementGenerator.h"
 
+class PathGenerator;
+
 template <class T>
 class HomeMovementGenerator : public MovementGeneratorMedium< T, HomeMovementGenerator<T> >
 {
     public:
         explicit HomeMovementGenerator();
+        ~HomeMovementGenerator();
 
         MovementGeneratorType GetMovementGeneratorType() const override;
 
@@ -36,6 +39,9 @@ class HomeMovementGenerator : public MovementGeneratorMedium< T, HomeMovementGen
 
     private:
         void SetTargetLocation(T*);
+        void LaunchMovement(T*);
+
+        std::unique_ptr<PathGenerator> _path;   // only set while path is being calculated
 };
 
 #endif
@@ -16,6 +16,7 @@
  */
 
 #include "PathGenerator.h"
+#include "AsyncPathfinder.h"
 #include "Creature.h"
 #include "DetourCommon.h"
 #include "DetourNavMeshQuery.h"
@@ -25,6 +26,7 @@
 #include "MMapFactory.h"
 #include "MMapManager.h"
 #include "Map.h"
+#include "MapManager.h"
 #include "Metric.h"
 #include "PhasingHandler.h"
 
@@ -32,8 +34,9 @@
 PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false),
     _forceDestination(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
-    _startPosition(PositionToVector3(owner)), _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _startPosition(PositionToVector3(owner)), _endPosition(G3D::Vector3::zero()), _source(owner), _sourceGuid(owner->GetGUID()),
+    _sourceMapId(owner->GetMapId()), _sourceInstanceId(owner->GetInstanceId()), _navMesh(nullptr), _navMeshQuery(nullptr),
+    _pathCache(nullptr), _asyncPathReady(false), _mapThreadStep(MapThreadStep::None), _queryCache(nullptr)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
@@ -45,18 +48,82 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
         MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
         _navMeshQuery = mmap->GetNavMeshQuery(mapId, _source->GetMapId(), _source->GetInstanceId());
         _navMesh = _navMeshQuery ? _navMeshQuery->getAttachedNavMesh() : mmap->GetNavMesh(mapId);
+        _navMeshData = mmap->GetNavMeshData(mapId);
+        _pathCache = mmap->GetPathCache(mapId);
     }
 
     CreateFilter();
 }
 
+PathGenerator::PathGenerator(PathGenerator const* owner) :
+    _polyLength(owner->_polyLength), _type(owner->_type), _useStraightPath(owner->_useStraightPath),
+    _forceDestination(owner->_forceDestination), _pointPathLimit(owner->_pointPathLimit), _useRaycast(owner->_useRaycast),
+    _startPosition(owner->_startPosition), _endPosition(owner->_endPosition), _actualEndPosition(owner->_actualEndPosition),
+    _source(nullptr), _sourceGuid(owner->_sourceGuid), _sourceMapId(owner->_sourceMapId), _sourceInstanceId(owner->_sourceInstanceId),
+    _navMesh(owner->_navMesh), _navMeshQuery(nullptr), _navMeshData(owner->_navMeshData), _pathCache(owner->_pathCache),
+    _asyncPathReady(false), _mapThreadStep(MapThreadStep::None), _queryCache(nullptr), _filter(owner->_filter)
+{
+    memcpy(_pathPolyRefs, owner->_pathPolyRefs, sizeof(_pathPolyRefs));
+}
+
 PathGenerator::~PathGenerator()
 {
-    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::~PathGenerator() for {}", _source->GetGUID().ToString());
+    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::~PathGenerator() for {}", _sourceGuid.ToString());
 }
 
 bool PathGenerator::CalculatePath(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool forceDest)
 {
+    return CalculatePathImpl(srcX, srcY, srcZ, destX, destY, destZ, forceDest, nullptr);
+}
+
+bool PathGenerator::CalculatePathAsync(float destX, float destY, float destZ, bool forceDest)
+{
+    float x, y, z;
+    _source->GetPosition(x, y, z);
+    return CalculatePathImpl(x, y, z, destX, destY, destZ, forceDest, sMapMgr->GetAsyncPathfinder());
+}
+
+bool PathGenerator::UpdateAsyncPath()
+{
+    if (!_asyncPath)
+        return true;
+
+    if (!_asyncPath->_asyncPathReady.load(std::memory_order_acquire))
+        return false;
+
+    std::shared_ptr<PathGenerator> result = std::move(_asyncPath);
+    if (result->_mapThreadStep == MapThreadStep::Recalculate)
+    {
+        BuildPolyPath(_startPosition, _endPosition);
+        return true;
+    }
+
+    memcpy(_pathPolyRefs, result->_pathPolyRefs, sizeof(_pathPolyRefs));
+    _polyLength = result->_polyLength;
+    _pathPoints = std::move(result->_pathPoints);
+    _type = result->_type;
+    _actualEndPosition = result->_actualEndPosition;
+
+    switch (result->_mapThreadStep)
+    {
+        case MapThreadStep::Normalize:
+            NormalizePath();
+            break;
+        case MapThreadStep::FinishPointPath:
+            FinishPointPath();
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+
+bool PathGenerator::CalculatePathImpl(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool forceDest, AsyncPathfinder* pathfinder)
+{
+    // a new calculation replaces the one still running on pathfinding threads
+    _asyncPath = nullptr;
+
     if (!Trinity::IsValidMapCoord(destX, destY, destZ) || !Trinity::IsValidMapCoord(srcX, srcY, srcZ))
         return false;
 
@@ -70,7 +137,7 @@ bool PathGenerator::CalculatePath(float srcX, float srcY, float srcZ, float dest
 
     _forceDestination = forceDest;
 
-    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::CalculatePath() for {}", _source->GetGUID().ToString());
+    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::CalculatePath() for {}", _sourceGuid.ToString());
 
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
@@ -85,10 +152,44 @@ bool PathGenerator::CalculatePath(float srcX, float srcY, float srcZ, float dest
 
     UpdateFilter();
 
+    if (pathfinder)
+    {
+        _asyncPath.reset(new PathGenerator(this));
+        pathfinder->Enqueue(_asyncPath);
+        return true;
+    }
+
     BuildPolyPath(start, dest);
     return true;
 }
 
+void PathGenerator::BuildDetachedPath(dtNavMeshQuery const* navMeshQuery, QueryCache& cache)
+{
+    if (navMeshQuery)
+    {
+        _navMeshQuery = navMeshQuery;
+        _queryCache = &cache;
+        BuildPolyPath(_startPosition, _endPosition);
+        _queryCache = nullptr;
+        _navMeshQuery = nullptr;
+    }
+    else
+        _mapThreadStep = MapThreadStep::Recalculate;
+
+    _asyncPathReady.store(true, std::memory_order_release);
+}
+
+bool PathGenerator::CanShareQueryWith(PathGenerator const& other) const
+{
+    return _navMesh == other._navMesh
+        && _endPosition == other._endPosition
+        && _filter.getIncludeFlags() == other._filter.getIncludeFlags()
+        && _filter.getExcludeFlags() == other._filter.getExcludeFlags()
+        && _useStraightPath == other._useStraightPath
+        && _useRaycast == other._useRaycast
+        && _pointPathLimit == other._pointPathLimit;
+}
+
 bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool forceDest)
 {
     float x, y, z;
@@ -162,6 +263,71 @@ dtPolyRef PathGenerator::GetPolyByLocation(float const* point, float* distance)
     return INVALID_POLYREF;
 }
 
+dtPolyRef PathGenerator::GetEndPolyByLocation(float const* point, float* distance) const
+{
+    // paths calculated together share the destination lookup, unless they find it on their previous path
+    if (!_queryCache || _polyLength)
+        return GetPolyByLocation(point, distance);
+
+    if (!_queryCache->EndPoly)
+    {
+        float endDistance;
+        dtPolyRef endPoly = GetPolyByLocation(point, &endDistance);
+        _queryCache->EndPoly.emplace(endPoly, endDistance);
+    }
+
+    *distance = _queryCache->EndPoly->second;
+    return _queryCache->EndPoly->first;
+}
+
+dtStatus PathGenerator::FindPolyPath(dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint)
+{
+    // paths calculated together starting on the same polygon follow the same corridor
+    if (_queryCache)
+    {
+        for (QueryCache::PolyPath const& polyPath : _queryCache->PolyPaths)
+        {
+            if (polyPath.StartPoly == startPoly && polyPath.EndPoly == endPoly)
+            {
+                memcpy(_pathPolyRefs, polyPath.Polys, sizeof(dtPolyRef) * polyPath.Length);
+                _polyLength = polyPath.Length;
+                return polyPath.Status;
+            }
+        }
+    }
+
+    // same for paths recalculated every few updates while chasing or following a target on the same polygon
+    MMAP::PathCacheKey pathCacheKey{ _sourceMapId, _sourceInstanceId, startPoly, endPoly, _filter.getIncludeFlags(), _filter.getExcludeFlags() };
+    dtStatus dtResult;
+    if (!_pathCache || !_pathCache->Find(pathCacheKey, _pathPolyRefs, (int32*)&_polyLength, MAX_PATH_LENGTH, &dtResult))
+    {
+        dtResult = _navMeshQuery->findPath(
+                    startPoly,          // start polygon
+                    endPoly,            // end polygon
+                    startPoint,         // start position
+                    endPoint,           // end position
+                    &_filter,           // polygon search filter
+                    _pathPolyRefs,     // [out] path
+                    (int*)&_polyLength,
+                    MAX_PATH_LENGTH);   // max number of polygons in output path
+
+        if (_pathCache && dtStatusSucceed(dtResult))
+            _pathCache->Insert(pathCacheKey, _pathPolyRefs, _polyLength, dtResult);
+    }
+
+    if (_queryCache)
+    {
+        QueryCache::PolyPath& polyPath = _queryCache->PolyPaths.emplace_back();
+        polyPath.StartPoly = startPoly;
+        polyPath.EndPoly = endPoly;
+        polyPath.Status = dtResult;
+        polyPath.Length = _polyLength;
+        memcpy(polyPath.Polys, _pathPolyRefs, sizeof(dtPolyRef) * _polyLength);
+    }
+
+    return dtResult;
+}
+
 void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos)
 {
     // *** getting start/end poly logic ***
@@ -171,7 +337,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     float endPoint[VERTEX_SIZE] = {endPos.y, endPos.z, endPos.x};
 
     dtPolyRef startPoly = GetPolyByLocation(startPoint, &distToStartPoly);
-    dtPolyRef endPoly = GetPolyByLocation(endPoint, &distToEndPoly);
+    dtPolyRef endPoly = GetEndPolyByLocation(endPoint, &distToEndPoly);
 
     _type = PathType(PATHFIND_NORMAL);
 
@@ -181,6 +347,12 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     if (startPoly == INVALID_POLYREF || endPoly == INVALID_POLYREF)
     {
         TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: (startPoly == 0 || endPoly == 0)");
+        if (!_source)
+        {
+            _mapThreadStep = MapThreadStep::Recalculate;
+            return;
+        }
+
         BuildShortcut();
         bool path = _source->GetTypeId() == TYPEID_UNIT && _source->ToCreature()->CanFly();
 
@@ -220,6 +392,11 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     if (startFarFromPoly || endFarFromPoly)
     {
         TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: farFromPoly distToStartPoly={:.3f} distToEndPoly={:.3f}", distToStartPoly, distToEndPoly);
+        if (!_source)
+        {
+            _mapThreadStep = MapThreadStep::Recalculate;
+            return;
+        }
 
         bool buildShotrcut = false;
 
@@ -310,7 +487,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
                 TC_LOG_ERROR("maps.mmaps", "Invalid poly ref in BuildPolyPath. _polyLength: {}, pathStartIndex: {},"
                                      " startPos: {}, endPos: {}, mapid: {}",
                                      _polyLength, pathStartIndex, startPos.toString(), endPos.toString(),
-                                     _source->GetMapId());
+                                     _sourceMapId);
 
                 break;
             }
@@ -385,7 +562,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         dtStatus dtResult;
         if (_useRaycast)
         {
-            TC_LOG_ERROR("maps.mmaps", "PathGenerator::BuildPolyPath() called with _useRaycast with a previous path for unit {}", _source->GetGUID().ToString());
+            TC_LOG_ERROR("maps.mmaps", "PathGenerator::BuildPolyPath() called with _useRaycast with a previous path for unit {}", _sourceGuid.ToString());
             BuildShortcut();
             _type = PATHFIND_NOPATH;
             return;
@@ -408,7 +585,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
             // this is probably an error state, but we'll leave it
             // and hopefully recover on the next Update
             // we still need to copy our preffix
-            TC_LOG_ERROR("maps.mmaps", "Path Build failed\n{}", _source->GetDebugInfo());
+            TC_LOG_ERROR("maps.mmaps", "Path Build failed\n{}", GetSourceDebugInfo());
         }
 
         TC_LOG_DEBUG("maps.mmaps", "++  m_polyLength={} prefixPolyLength={} suffixPolyLength={}", _polyLength, prefixPolyLength, suffixPolyLength);
@@ -498,22 +675,12 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
             }
         }
         else
-        {
-            dtResult = _navMeshQuery->findPath(
-                            startPoly,          // start polygon
-                            endPoly,            // end polygon
-                            startPoint,         // start position
-                            endPoint,           // end position
-                            &_filter,           // polygon search filter
-                            _pathPolyRefs,     // [out] path
-                            (int*)&_polyLength,
-                            MAX_PATH_LENGTH);   // max number of polygons in output path
-        }
+            dtResult = FindPolyPath(startPoly, endPoly, startPoint, endPoint);
 
         if (!_polyLength || dtStatusFailed(dtResult))
         {
             // only happens if we passed bad data to findPath(), or navmesh is messed up
-            TC_LOG_ERROR("maps.mmaps", "{} Path Build failed: 0 length path", _source->GetGUID().ToString());
+            TC_LOG_ERROR("maps.mmaps", "{} Path Build failed: 0 length path", _sourceGuid.ToString());
             BuildShortcut();
             _type = PATHFIND_NOPATH;
             return;
@@ -540,7 +707,7 @@ void PathGenerator::BuildPointPath(const float *startPoint, const float *endPoin
     if (_useRaycast)
     {
         // _straightLine uses raycast and it currently doesn't support building a point path, only a 2-point path with start and hitpoint/end is returned
-        TC_LOG_ERROR("maps.mmaps", "PathGenerator::BuildPointPath() called with _useRaycast for unit {}", _source->GetGUID().ToString());
+        TC_LOG_ERROR("maps.mmaps", "PathGenerator::BuildPointPath() called with _useRaycast for unit {}", _sourceGuid.ToString());
         BuildShortcut();
         _type = PATHFIND_NOPATH;
         return;
@@ -599,6 +766,19 @@ void PathGenerator::BuildPointPath(const float *startPoint, const float *endPoin
     for (uint32 i = 0; i < pointCount; ++i)
         _pathPoints[i] = G3D::Vector3(pathPoints[i*VERTEX_SIZE+2], pathPoints[i*VERTEX_SIZE], pathPoints[i*VERTEX_SIZE+1]);
 
+    if (!_source)
+    {
+        _mapThreadStep = MapThreadStep::FinishPointPath;
+        return;
+    }
+
+    FinishPointPath();
+}
+
+void PathGenerator::FinishPointPath()
+{
+    std::size_t pointCount = _pathPoints.size();
+
     NormalizePath();
 
     // first point is always our current location - we need the next one
@@ -628,6 +808,12 @@ void PathGenerator::BuildPointPath(const float *startPoint, const float *endPoin
 
 void PathGenerator::NormalizePath()
 {
+    if (!_source)
+    {
+        _mapThreadStep = MapThreadStep::Normalize;
+        return;
+    }
+
     for (uint32 i = 0; i < _pathPoints.size(); ++i)
         _source->UpdateAllowedPositionZ(_pathPoints[i].x, _pathPoints[i].y, _pathPoints[i].z);
 }
@@ -887,7 +1073,7 @@ dtStatus PathGenerator::FindSmoothPath(float const* startPos, float const* endPo
         npolys = FixupCorridor(polys, npolys, MAX_PATH_LENGTH, visited, nvisited);
 
         if (dtStatusFailed(_navMeshQuery->getPolyHeight(polys[0], result, &result[1])))
-            TC_LOG_DEBUG("maps.mmaps", "Cannot find height at position X: {} Y: {} Z: {} for {}", result[2], result[0], result[1], _source->GetDebugInfo());
+            TC_LOG_DEBUG("maps.mmaps", "Cannot find height at position X: {} Y: {} Z: {} for {}", result[2], result[0], result[1], GetSourceDebugInfo());
         result[1] += 0.5f;
         dtVcopy(iterPos, result);
 
@@ -1048,3 +1234,8 @@ void PathGenerator::AddFarFromPolyFlags(bool startFarFromPoly, bool endFarFromPo
     if (endFarFromPoly)
         _type = PathType(_type | PATHFIND_FARFROMPOLY_END);
 }
+
+std::string PathGenerator::GetSourceDebugInfo() const
+{
+    return _source ? _source->GetDebugInfo() : _sourceGuid.ToString();
+}
@@ -22,10 +22,22 @@
 #include "DetourNavMeshQuery.h"
 #include "MMapDefines.h"
 #include "MoveSplineInitArgs.h"
+#include "ObjectGuid.h"
+#include "Optional.h"
 #include <G3D/Vector3.h>
+#include <atomic>
+#include <memory>
+#include <vector>
 
+class AsyncPathfinder;
 class WorldObject;
 
+namespace MMAP
+{
+    class PathCache;
+    struct MMapData;
+}
+
 // 74*4.0f=296y number_of_points*interval = max_path_len
 // this is way more than actual evade range
 // I think we can safely cut those down even more
@@ -67,6 +79,12 @@ class TC_GAME_API PathGenerator
         // return: true if new path was calculated, false otherwise (no change needed)
         bool CalculatePath(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool forceDest = false);
         bool CalculatePath(float destX, float destY, float destZ, bool forceDest = false);
+        // Same as CalculatePath but Detour queries run on pathfinding threads when they are enabled
+        // path is only replaced once UpdateAsyncPath returns true, at the latest on the next map update
+        bool CalculatePathAsync(float destX, float destY, float destZ, bool forceDest = false);
+        // Applies the result of CalculatePathAsync, returns false if it is still being calculated
+        bool UpdateAsyncPath();
+        bool IsCalculatingAsync() const { return _asyncPath != nullptr; }
         bool IsInvalidDestinationZ(WorldObject const* target) const;
 
         // option setters - use optional
@@ -88,6 +106,35 @@ class TC_GAME_API PathGenerator
         void ShortenPathUntilDist(G3D::Vector3 const& target, float dist);
 
     private:
+        friend class AsyncPathfinder;
+
+        // steps of a path calculated on pathfinding threads left for the map thread, they need terrain or unit state
+        enum class MapThreadStep : uint8
+        {
+            None,
+            Normalize,          // fix heights of points
+            FinishPointPath,    // fix heights of points and handle forced destination
+            Recalculate         // start or end is far from navmesh, calculate the whole path on map thread
+        };
+
+        // shared by paths with the same destination, filter and options calculated together
+        struct QueryCache
+        {
+            struct PolyPath
+            {
+                dtPolyRef StartPoly;
+                dtPolyRef EndPoly;
+                dtStatus Status;
+                uint32 Length;
+                dtPolyRef Polys[MAX_PATH_LENGTH];
+            };
+
+            Optional<std::pair<dtPolyRef, float>> EndPoly;  // destination polygon and distance to it
+            std::vector<PolyPath> PolyPaths;
+        };
+
+        // detached copy of owner, only holds what Detour queries need and never touches the source object
+        explicit PathGenerator(PathGenerator const* owner);
 
         dtPolyRef _pathPolyRefs[MAX_PATH_LENGTH];   // array of detour polygon references
         uint32 _polyLength;                         // number of polygons in the path
@@ -104,15 +151,28 @@ class TC_GAME_API PathGenerator
         G3D::Vector3 _endPosition;          // {x, y, z} of the destination
         G3D::Vector3 _actualEndPosition;    // {x, y, z} of the closest possible point to given destination
 
-        WorldObject const* const _source;       // the object that is moving
+        WorldObject const* const _source;       // the object that is moving, null for detached copies
+        ObjectGuid const _sourceGuid;
+        uint32 const _sourceMapId;
+        uint32 const _sourceInstanceId;
         dtNavMesh const* _navMesh;              // the nav mesh
         dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        std::shared_ptr<MMAP::MMapData> _navMeshData;   // keeps nav mesh and path cache alive, tileLock is held by pathfinding threads while querying
+        MMAP::PathCache* _pathCache;            // polygon corridors found before on the same nav mesh
+
+        std::shared_ptr<PathGenerator> _asyncPath;  // detached copy queued by CalculatePathAsync
+        std::atomic<bool> _asyncPathReady;          // set on detached copy once pathfinding thread is done with it
+        MapThreadStep _mapThreadStep;
+        QueryCache* _queryCache;
 
         dtQueryFilter _filter;  // use single filter for all movements, update it when needed
 
         void SetStartPosition(G3D::Vector3 const& point) { _startPosition = point; }
         void SetEndPosition(G3D::Vector3 const& point) { _actualEndPosition = point; _endPosition = point; }
         void SetActualEndPosition(G3D::Vector3 const& point) { _actualEndPosition = point; }
+        bool CalculatePathImpl(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool forceDest, AsyncPathfinder* pathfinder);
+        void BuildDetachedPath(dtNavMeshQuery const* navMeshQuery, QueryCache& cache);
+        bool CanShareQueryWith(PathGenerator const& other) const;
         void NormalizePath();
 
         void Clear()
@@ -127,10 +187,13 @@ class TC_GAME_API PathGenerator
 
         dtPolyRef GetPathPolyByPosition(dtPolyRef const* polyPath, uint32 polyPathSize, float const* Point, float* Distance = nullptr) const;
         dtPolyRef GetPolyByLocation(float const* Point, float* Distance) const;
+        dtPolyRef GetEndPolyByLocation(float const* point, float* distance) const;
+        dtStatus FindPolyPath(dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint);
         bool HaveTile(G3D::Vector3 const& p) const;
 
         void BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
         void BuildPointPath(float const* startPoint, float const* endPoint);
+        void FinishPointPath();
         void BuildShortcut();
 
         NavTerrainFlag GetNavTerrain(float x, float y, float z) const;
@@ -146,6 +209,7 @@ class TC_GAME_API PathGenerator
                               float* smoothPath, int* smoothPathSize, uint32 maxSmoothPathSize);
 
         void AddFarFromPolyFlags(bool startFarFromPoly, bool endFarFromPoly);
+        std::string GetSourceDebugInfo() const;
 };
 
 #endif
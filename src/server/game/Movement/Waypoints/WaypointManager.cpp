@@ -16,6 +16,7 @@
  */
 
 #include "WaypointManager.h"
+#include "ByteBuffer.h"
 #include "DatabaseEnv.h"
 #include "GridDefines.h"
 #include "Log.h"
@@ -23,6 +24,7 @@
 #include "ObjectAccessor.h"
 #include "Optional.h"
 #include "QueryResultStructured.h"
+#include "StartupSnapshot.h"
 #include "TemporarySummon.h"
 #include "Unit.h"
 
@@ -162,6 +164,91 @@ void WaypointMgr::DoPostLoadingChecks()
     }
 }
 
+void WaypointMgr::WriteSnapshot(ByteBuffer& data) const
+{
+    data << uint32(_pathStore.size());
+    for (auto const& [pathId, path] : _pathStore)
+    {
+        // paths with invalid MoveType keep Id 0, they are still stored under their own id
+        data << uint32(pathId);
+        data << uint32(path.Id);
+        data << uint8(path.MoveType);
+        data << uint8(path.Flags.AsUnderlyingType());
+        data << float(path.Velocity.value_or(0.0f));
+
+        data << uint32(path.Nodes.size());
+        for (WaypointNode const& node : path.Nodes)
+        {
+            data << uint32(node.Id);
+            data << float(node.X);
+            data << float(node.Y);
+            data << float(node.Z);
+            data << uint8(node.Orientation.has_value());
+            data << float(node.Orientation.value_or(0.0f));
+            data << uint32(node.Delay.value_or(0ms).count());
+            data << uint8(node.MoveType);
+        }
+
+        data << uint32(path.ContinuousSegments.size());
+        for (auto const& [start, length] : path.ContinuousSegments)
+        {
+            data << uint32(start);
+            data << uint32(length);
+        }
+    }
+}
+
+void WaypointMgr::ReadSnapshot(StartupSnapshotReader& data)
+{
+    std::unordered_map<uint32, WaypointPath> pathStore;
+
+    uint32 pathCount = data.ReadCount();
+    pathStore.reserve(pathCount);
+    for (uint32 i = 0; i < pathCount; ++i)
+    {
+        uint32 pathId = data.read<uint32>();
+        WaypointPath path;
+        path.Id = data.read<uint32>();
+        path.MoveType = WaypointMoveType(data.read<uint8>());
+        path.Flags = WaypointPathFlags(data.read<uint8>());
+        if (float velocity = data.read<float>(); velocity > 0.0f)
+            path.Velocity = velocity;
+
+        path.Nodes.resize(data.ReadCount());
+        for (WaypointNode& node : path.Nodes)
+        {
+            node.Id = data.read<uint32>();
+            node.X = data.read<float>();
+            node.Y = data.read<float>();
+            node.Z = data.read<float>();
+            bool hasOrientation = data.read<uint8>() != 0;
+            float orientation = data.read<float>();
+            if (hasOrientation)
+                node.Orientation = orientation;
+            if (uint32 delayMs = data.read<uint32>())
+                node.Delay.emplace(delayMs);
+            node.MoveType = WaypointMoveType(data.read<uint8>());
+        }
+
+        path.ContinuousSegments.resize(data.ReadCount());
+        for (auto& [start, length] : path.ContinuousSegments)
+        {
+            start = data.read<uint32>();
+            length = data.read<uint32>();
+        }
+
+        pathStore.try_emplace(pathId, std::move(path));
+    }
+
+    data.ReadEnd();
+    _pathStore = std::move(pathStore);
+}
+
+void WaypointMgr::InvalidateSnapshot() const
+{
+    sStartupSnapshot->Invalidate(SnapshotName);
+}
+
 WaypointMgr* WaypointMgr::instance()
 {
     static WaypointMgr instance;
@@ -170,6 +257,9 @@ WaypointMgr* WaypointMgr::instance()
 
 void WaypointMgr::ReloadPath(uint32 pathId)
 {
+    // path is reloaded because it was changed in database
+    InvalidateSnapshot();
+
     // waypoint_path
     {
         WorldDatabasePreparedStatement* stmt = WorldDatabase.GetPreparedStatement(WORLD_SEL_WAYPOINT_PATH);
@@ -269,6 +359,8 @@ void WaypointMgr::MoveNode(WaypointPath const* path, WaypointNode const* node, P
     stmt->setUInt32(4, path->Id);
     stmt->setUInt32(5, node->Id);
     WorldDatabase.Execute(stmt);
+
+    InvalidateSnapshot();
 }
 
 void WaypointMgr::DeleteNode(WaypointPath const* path, WaypointNode const* node)
@@ -282,6 +374,8 @@ void WaypointMgr::DeleteNode(WaypointPath const* path, WaypointNode const* node)
     stmt->setUInt32(0, path->Id);
     stmt->setUInt32(1, node->Id);
     WorldDatabase.Execute(stmt);
+
+    InvalidateSnapshot();
 }
 
 void WaypointMgr::DeleteNode(uint32 pathId, uint32 nodeId)
@@ -24,8 +24,11 @@
 #include "ObjectGuid.h"
 #include "Position.h"
 #include "WaypointDefines.h"
+#include <string_view>
 #include <unordered_map>
 
+class ByteBuffer;
+class StartupSnapshotReader;
 class Unit;
 
 class TC_GAME_API WaypointMgr
@@ -50,6 +53,14 @@ class TC_GAME_API WaypointMgr
         void LoadPathNodesFromDB(PathNodeQueryResult const& fields);
         void DoPostLoadingChecks();
 
+        // Startup snapshot of loaded paths, see StartupSnapshot
+        static constexpr std::string_view SnapshotName = "waypoint_paths";
+        static constexpr uint32 SnapshotVersion = 2;
+        void WriteSnapshot(ByteBuffer& data) const;
+        void ReadSnapshot(StartupSnapshotReader& data);
+        // Must be called after writing to `waypoint_path` or `waypoint_path_node`, the snapshot would revert the change on next startup
+        void InvalidateSnapshot() const;
+
         void VisualizePath(Unit* owner, WaypointPath const* path, Optional<uint32> displayId);
         void DevisualizePath(Unit* owner, WaypointPath const* path);
 
@@ -17,6 +17,7 @@
 
 #include "Opcodes.h"
 #include "Log.h"
+#include "MetricsRegistry.h"
 #include "WorldSession.h"
 #include "Packets/AllPackets.h"
 
@@ -86,6 +87,20 @@ void OpcodeTable::ValidateAndSetClientOpcode(OpcodeClient opcode, char const* na
     });
 }
 
+Trinity::Metrics::Histogram& ClientOpcodeHandler::GetDurationHistogram() const
+{
+    // racing threads get the same histogram from registry
+    Trinity::Metrics::Histogram* histogram = DurationHistogram.load(std::memory_order_acquire);
+    if (!histogram)
+    {
+        histogram = &sMetricsRegistry->GetHistogram("trinity_world_packet_handler_duration_seconds", "Duration of client packet handling",
+            Trinity::StringFormat("opcode=\"{}\"", Name));
+        DurationHistogram.store(histogram, std::memory_order_release);
+    }
+
+    return *histogram;
+}
+
 bool OpcodeTable::ValidateServerOpcode(OpcodeServer opcode, char const* name, ConnectionType conIdx) const
 {
     if (opcode == UNKNOWN_OPCODE)
@@ -24,6 +24,7 @@
 
 #include "Define.h"
 #include <array>
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -2270,6 +2271,11 @@ enum PacketProcessing
 class WorldPacket;
 class WorldSession;
 
+namespace Trinity::Metrics
+{
+class Histogram;
+}
+
 struct ClientOpcodeHandler
 {
     using HandlerFunction = void (*)(WorldSession* session, WorldPacket& packet);
@@ -2278,6 +2284,10 @@ struct ClientOpcodeHandler
     SessionStatus Status;
     HandlerFunction Call;
     PacketProcessing ProcessingPlace;
+
+    /// Handler duration histogram labelled with opcode name, registered on first use so only received opcodes are exported
+    Trinity::Metrics::Histogram& GetDurationHistogram() const;
+    mutable std::atomic<Trinity::Metrics::Histogram*> DurationHistogram = nullptr;
 };
 
 struct ServerOpcodeHandler
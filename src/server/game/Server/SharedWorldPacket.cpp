@@ -0,0 +1,154 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SharedWorldPacket.h"
+#include "BufferPool.h"
+#include "Log.h"
+#include "World.h"
+#include "WorldPacket.h"
+#include <atomic>
+#include <cstring>
+#include <zlib.h>
+
+namespace
+{
+thread_local WorldPacketBroadcast* CurrentBroadcast = nullptr;
+
+std::atomic<uint64> CopiedBytesCounter;
+std::atomic<uint64> CompressedBytesCounter;
+std::atomic<uint64> SharedSendsCounter;
+
+// raw deflate stream with the same parameters as WorldSocket compression, reset for every packet
+struct CompressionStream
+{
+    CompressionStream()
+    {
+        Initialized = deflateInit2(&Stream, sWorld->getIntConfig(CONFIG_COMPRESSION), Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+    }
+
+    ~CompressionStream()
+    {
+        if (Initialized)
+            deflateEnd(&Stream);
+    }
+
+    z_stream Stream = { };
+    bool Initialized;
+};
+}
+
+SharedWorldPacket::SharedWorldPacket(WorldPacket const& packet) : _opcode(packet.GetOpcode()),
+    _data(Trinity::BufferPool::Acquire(packet.size() + sizeof(uint32)))
+{
+    _data.resize(packet.size() + sizeof(uint32));
+    memcpy(_data.data(), &_opcode, sizeof(uint32));
+    if (!packet.empty())
+        memcpy(_data.data() + sizeof(uint32), packet.data(), packet.size());
+
+    WorldPacketSendStatistics::AddCopiedBytes(packet.size());
+}
+
+SharedWorldPacket::~SharedWorldPacket()
+{
+    Trinity::BufferPool::Release(std::move(_data));
+}
+
+SharedWorldPacket::CompressedData const& SharedWorldPacket::GetCompressed() const
+{
+    std::call_once(_compressedFlag, [this]()
+    {
+        thread_local CompressionStream compression;
+        if (!compression.Initialized)
+            return;
+
+        z_stream& stream = compression.Stream;
+        deflateReset(&stream);
+
+        _compressed.Data.resize(deflateBound(&stream, _data.size()));
+        stream.next_in = const_cast<Bytef*>(_data.data());
+        stream.avail_in = _data.size();
+        stream.next_out = _compressed.Data.data();
+        stream.avail_out = _compressed.Data.size();
+
+        // sync flush instead of finish - result continues the client side inflate stream of any connection
+        int32 z_res = deflate(&stream, Z_SYNC_FLUSH);
+        if (z_res != Z_OK)
+        {
+            TC_LOG_ERROR("network", "Can't compress shared packet (zlib: deflate) Error code: {} ({}, msg: {})", z_res, zError(z_res), stream.msg);
+            _compressed.Data.clear();
+            return;
+        }
+
+        _compressed.Data.resize(_compressed.Data.size() - stream.avail_out);
+        _compressed.UncompressedAdler = adler32(0x9827D8F1, _data.data(), _data.size());
+        _compressed.CompressedAdler = adler32(0x9827D8F1, _compressed.Data.data(), _compressed.Data.size());
+        WorldPacketSendStatistics::AddCompressedBytes(_data.size());
+    });
+
+    return _compressed;
+}
+
+WorldPacketBroadcast::WorldPacketBroadcast(WorldPacket const& packet) : _packet(packet), _previous(CurrentBroadcast)
+{
+    CurrentBroadcast = this;
+}
+
+WorldPacketBroadcast::~WorldPacketBroadcast()
+{
+    CurrentBroadcast = _previous;
+}
+
+std::shared_ptr<SharedWorldPacket const> WorldPacketBroadcast::GetSharedPacket(WorldPacket const& packet)
+{
+    for (WorldPacketBroadcast* broadcast = CurrentBroadcast; broadcast; broadcast = broadcast->_previous)
+    {
+        if (&broadcast->_packet != &packet)
+            continue;
+
+        // created on first send, broadcasts without recipients cost nothing
+        if (!broadcast->_shared)
+            broadcast->_shared = std::make_shared<SharedWorldPacket>(packet);
+
+        return broadcast->_shared;
+    }
+
+    return nullptr;
+}
+
+void WorldPacketSendStatistics::AddCopiedBytes(std::size_t bytes)
+{
+    CopiedBytesCounter.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void WorldPacketSendStatistics::AddCompressedBytes(std::size_t bytes)
+{
+    CompressedBytesCounter.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void WorldPacketSendStatistics::AddSharedSend()
+{
+    SharedSendsCounter.fetch_add(1, std::memory_order_relaxed);
+}
+
+WorldPacketSendStatistics WorldPacketSendStatistics::Consume()
+{
+    WorldPacketSendStatistics statistics;
+    statistics.CopiedBytes = CopiedBytesCounter.exchange(0, std::memory_order_relaxed);
+    statistics.CompressedBytes = CompressedBytesCounter.exchange(0, std::memory_order_relaxed);
+    statistics.SharedSends = SharedSendsCounter.exchange(0, std::memory_order_relaxed);
+    return statistics;
+}
@@ -0,0 +1,104 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_SHARED_WORLD_PACKET_H
+#define TRINITYCORE_SHARED_WORLD_PACKET_H
+
+#include "Define.h"
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+class WorldPacket;
+
+/*
+ * Immutable copy of a packet sent to many sessions, queued by reference in every recipient socket.
+ * Compressed form is built once by the first socket that needs it, every socket only adds its own header and encryption.
+ */
+class TC_GAME_API SharedWorldPacket
+{
+public:
+    struct CompressedData
+    {
+        std::vector<uint8> Data;        ///< raw deflate blocks of opcode and payload, ending with a sync flush
+        uint32 UncompressedAdler = 0;
+        uint32 CompressedAdler = 0;
+    };
+
+    explicit SharedWorldPacket(WorldPacket const& packet);
+    ~SharedWorldPacket();
+
+    SharedWorldPacket(SharedWorldPacket const&) = delete;
+    SharedWorldPacket& operator=(SharedWorldPacket const&) = delete;
+
+    uint32 GetOpcode() const { return _opcode; }
+
+    // Opcode followed by payload, exactly as written before compression
+    std::span<uint8 const> GetData() const { return _data; }
+    std::size_t GetPayloadSize() const { return _data.size() - sizeof(uint32); }
+
+    // Compressed independently of any connection, so it is valid in every socket compression stream
+    // Data is empty if compression failed
+    CompressedData const& GetCompressed() const;
+
+private:
+    uint32 _opcode;
+    std::vector<uint8> _data;
+
+    mutable std::once_flag _compressedFlag;
+    mutable CompressedData _compressed;
+};
+
+/*
+ * Marks a packet as being broadcast by the current thread.
+ * While alive, WorldSocket::SendPacket queues the packet by reference to a single SharedWorldPacket instead of copying it.
+ * The packet must not be modified while the broadcast is active.
+ */
+class TC_GAME_API WorldPacketBroadcast
+{
+public:
+    explicit WorldPacketBroadcast(WorldPacket const& packet);
+    ~WorldPacketBroadcast();
+
+    WorldPacketBroadcast(WorldPacketBroadcast const&) = delete;
+    WorldPacketBroadcast& operator=(WorldPacketBroadcast const&) = delete;
+
+    // Returns shared copy of packet if it is being broadcast by this thread, nullptr otherwise
+    static std::shared_ptr<SharedWorldPacket const> GetSharedPacket(WorldPacket const& packet);
+
+private:
+    WorldPacket const& _packet;
+    std::shared_ptr<SharedWorldPacket const> _shared;
+    WorldPacketBroadcast* _previous;
+};
+
+struct TC_GAME_API WorldPacketSendStatistics
+{
+    uint64 CopiedBytes = 0;         ///< packet bytes copied into socket send queues
+    uint64 CompressedBytes = 0;     ///< packet bytes passed through deflate
+    uint64 SharedSends = 0;         ///< sends queued by reference to a shared packet
+
+    static void AddCopiedBytes(std::size_t bytes);
+    static void AddCompressedBytes(std::size_t bytes);
+    static void AddSharedSend();
+
+    // Returns statistics collected since previous call
+    static WorldPacketSendStatistics Consume();
+};
+
+#endif // TRINITYCORE_SHARED_WORLD_PACKET_H
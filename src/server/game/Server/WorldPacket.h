@@ -21,6 +21,7 @@
 #include "ByteBuffer.h"
 #include "Opcodes.h"
 #include "Duration.h"
+#include <atomic>
 
 class WorldPacket : public ByteBuffer
 {
@@ -43,7 +44,8 @@ class WorldPacket : public ByteBuffer
         WorldPacket(WorldPacket&& packet) noexcept : ByteBuffer(std::move(packet)),
             m_opcode(packet.m_opcode), _connection(packet._connection), m_receivedTime(packet.m_receivedTime) { }
 
-        WorldPacket(WorldPacket const& right) = default;
+        WorldPacket(WorldPacket const& right) : ByteBuffer(right),
+            m_opcode(right.m_opcode), _connection(right._connection), m_receivedTime(right.m_receivedTime) { }
 
         explicit WorldPacket(std::vector<uint8>&& buffer, ConnectionType connection) : ByteBuffer(std::move(buffer)),
             m_opcode(UNKNOWN_OPCODE), _connection(connection) { }
@@ -75,7 +77,7 @@ class WorldPacket : public ByteBuffer
         void Initialize(uint32 opcode, size_t newres = 200, ConnectionType connection = CONNECTION_TYPE_DEFAULT)
         {
             clear();
-            _storage.reserve(newres);
+            reserve(newres);
             m_opcode = opcode;
             _connection = connection;
         }
@@ -88,6 +90,9 @@ class WorldPacket : public ByteBuffer
         TimePoint GetReceivedTime() const { return m_receivedTime; }
         void SetReceiveTime(TimePoint receivedTime) { m_receivedTime = receivedTime; }
 
+        // link used by lock free receive queue of WorldSession, never copied
+        std::atomic<WorldPacket*> QueueLink = nullptr;
+
     protected:
         uint32 m_opcode;
         ConnectionType _connection;
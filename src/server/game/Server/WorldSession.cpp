@@ -182,8 +182,7 @@ WorldSession::~WorldSession()
     delete _RBACData;
 
     ///- empty incoming packet queue
-    WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    for (WorldPacket* packet : _recvPending)
         delete packet;
 
     LoginDatabase.PExecute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
@@ -319,7 +318,27 @@ void WorldSession::AddInstanceConnection(WorldSession* session, std::weak_ptr<Wo
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvQueue.Enqueue(new_packet);
+}
+
+/// Takes next received packet if the filter allows processing it, otherwise leaves it at the front of the queue
+bool WorldSession::GetNextReceivedPacket(WorldPacket*& packet, PacketFilter& filter)
+{
+    if (_recvPending.empty())
+    {
+        WorldPacket* received = nullptr;
+        if (!_recvQueue.Dequeue(received))
+            return false;
+
+        _recvPending.push_back(received);
+    }
+
+    if (!filter.Process(_recvPending.front()))
+        return false;
+
+    packet = _recvPending.front();
+    _recvPending.pop_front();
+    return true;
 }
 
 /// Logging helper for unexpected opcodes
@@ -360,11 +379,12 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 100;
 
-    while (m_Socket[CONNECTION_TYPE_REALM] && _recvQueue.next(packet, updater))
+    while (m_Socket[CONNECTION_TYPE_REALM] && GetNextReceivedPacket(packet, updater))
     {
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
         TC_METRIC_DETAILED_TIMER("worldsession_update_opcode_time", TC_METRIC_TAG("opcode", opHandle->Name));
+        Trinity::Metrics::HistogramTimer handlerDuration(opHandle->GetDurationHistogram());
 
         try
         {
@@ -496,7 +516,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     TC_METRIC_VALUE("processed_packets", processedPackets);
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+    _recvPending.insert(_recvPending.begin(), requeuePackets.begin(), requeuePackets.end());
 
     if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
     {
@@ -29,15 +29,17 @@
 #include "DatabaseEnvFwd.h"
 #include "Duration.h"
 #include "IteratorPair.h"
-#include "LockedQueue.h"
+#include "MPSCQueue.h"
 #include "ObjectGuid.h"
 #include "Opcodes.h"
 #include "Optional.h"
 #include "RaceMask.h"
 #include "SharedDefines.h"
+#include "WorldPacket.h"
 #include <boost/circular_buffer_fwd.hpp>
 #include <array>
 #include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -1064,6 +1066,7 @@ class TC_GAME_API WorldSession
         bool DisallowHyperlinksAndMaybeKick(std::string const& str);
 
         void QueuePacket(WorldPacket* new_packet);
+        bool GetNextReceivedPacket(WorldPacket*& packet, PacketFilter& filter);
         bool Update(uint32 diff, PacketFilter& updater);
 
         /// Handle the authentication waiting queue (to be completed)
@@ -2029,7 +2032,8 @@ class TC_GAME_API WorldSession
         bool _filterAddonMessages;
         uint32 recruiterId;
         bool isRecruiter;
-        LockedQueue<WorldPacket*> _recvQueue;
+        MPSCQueue<WorldPacket, &WorldPacket::QueueLink> _recvQueue;
+        std::deque<WorldPacket*> _recvPending;          // taken from _recvQueue but not processed yet, accessed only by thread updating this session
         rbac::RBACData* _RBACData;
         uint32 expireTime;
         bool forceExit;
@@ -205,7 +205,7 @@ bool WorldSocket::Update()
     MessageBuffer buffer(_sendBufferSize);
     while (_bufferQueue.Dequeue(queued))
     {
-        uint32 packetSize = queued->size() + 4 /*opcode*/;
+        uint32 packetSize = queued->GetPayloadSize() + 4 /*opcode*/;
         if (packetSize > MinSizeForCompression && queued->NeedsEncryption())
             packetSize = deflateBound(_compressionStream, packetSize) + sizeof(CompressedWorldPacket);
 
@@ -535,11 +535,25 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     if (sPacketLog->CanLogPacket())
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort(), GetConnectionType());
 
+    if (std::shared_ptr<SharedWorldPacket const> shared = WorldPacketBroadcast::GetSharedPacket(packet))
+    {
+        WorldPacketSendStatistics::AddSharedSend();
+        _bufferQueue.Enqueue(new EncryptablePacket(std::move(shared), _authCrypt.IsInitialized()));
+        return;
+    }
+
+    WorldPacketSendStatistics::AddCopiedBytes(packet.size());
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
 }
 
 void WorldSocket::WritePacketToBuffer(EncryptablePacket const& packet, MessageBuffer& buffer)
 {
+    if (SharedWorldPacket const* shared = packet.GetSharedPacket())
+    {
+        WriteSharedPacketToBuffer(*shared, packet.NeedsEncryption(), buffer);
+        return;
+    }
+
     uint32 opcode = packet.GetOpcode();
     uint32 packetSize = packet.size();
 
@@ -582,6 +596,53 @@ void WorldSocket::WritePacketToBuffer(EncryptablePacket const& packet, MessageBu
     memcpy(headerPos, &header, sizeof(PacketHeader));
 }
 
+void WorldSocket::WriteSharedPacketToBuffer(SharedWorldPacket const& packet, bool encrypt, MessageBuffer& buffer)
+{
+    std::span<uint8 const> data = packet.GetData();
+
+    SharedWorldPacket::CompressedData const* compressed = nullptr;
+    if (packet.GetPayloadSize() > MinSizeForCompression && encrypt)
+    {
+        compressed = &packet.GetCompressed();
+        if (compressed->Data.empty())
+            compressed = nullptr;
+    }
+
+    // Reserve space for buffer
+    uint8* headerPos = buffer.GetWritePointer();
+    buffer.WriteCompleted(sizeof(PacketHeader));
+    uint8* dataPos = buffer.GetWritePointer();
+
+    PacketHeader header;
+    if (compressed)
+    {
+        uint32 opcode = SMSG_COMPRESSED_PACKET;
+        CompressedWorldPacket cmp;
+        cmp.UncompressedSize = data.size();
+        cmp.UncompressedAdler = compressed->UncompressedAdler;
+        cmp.CompressedAdler = compressed->CompressedAdler;
+
+        buffer.Write(&opcode, sizeof(opcode));
+        buffer.Write(&cmp, sizeof(CompressedWorldPacket));
+        buffer.Write(compressed->Data.data(), compressed->Data.size());
+        header.Size = sizeof(opcode) + sizeof(CompressedWorldPacket) + compressed->Data.size();
+
+        // client inflated these bytes with its connection stream, keep our deflate history in sync with it
+        int32 z_res = deflateSetDictionary(_compressionStream, data.data(), data.size());
+        if (z_res != Z_OK)
+            TC_LOG_ERROR("network", "Can't update packet compression history (zlib: deflateSetDictionary) Error code: {} ({})", z_res, zError(z_res));
+    }
+    else
+    {
+        buffer.Write(data.data(), data.size());
+        header.Size = data.size();
+    }
+
+    _authCrypt.EncryptSend(dataPos, header.Size, header.Tag);
+
+    memcpy(headerPos, &header, sizeof(PacketHeader));
+}
+
 uint32 WorldSocket::CompressPacket(uint8* buffer, WorldPacket const& packet)
 {
     uint32 opcode = packet.GetOpcode();
@@ -602,6 +663,8 @@ uint32 WorldSocket::CompressPacket(uint8* buffer, WorldPacket const& packet)
     _compressionStream->next_in = (Bytef*)packet.data();
     _compressionStream->avail_in = packet.size();
 
+    WorldPacketSendStatistics::AddCompressedBytes(packet.size() + sizeof(opcode));
+
     z_res = deflate(_compressionStream, Z_SYNC_FLUSH);
     if (z_res != Z_OK)
     {
@@ -22,6 +22,7 @@
 #include "AuthDefines.h"
 #include "DatabaseEnvFwd.h"
 #include "MessageBuffer.h"
+#include "SharedWorldPacket.h"
 #include "Socket.h"
 #include "WorldPacket.h"
 #include "WorldPacketCrypt.h"
@@ -50,11 +51,21 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    EncryptablePacket(std::shared_ptr<SharedWorldPacket const> packet, bool encrypt) : WorldPacket(packet->GetOpcode()),
+        _shared(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
     bool NeedsEncryption() const { return _encrypt; }
 
+    SharedWorldPacket const* GetSharedPacket() const { return _shared.get(); }
+    std::size_t GetPayloadSize() const { return _shared ? _shared->GetPayloadSize() : size(); }
+
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<SharedWorldPacket const> _shared;
     bool _encrypt;
 };
 
@@ -144,6 +155,7 @@ private:
     /// sends and logs network.opcode without accessing WorldSession
     void SendPacketAndLogOpcode(WorldPacket const& packet);
     void WritePacketToBuffer(EncryptablePacket const& packet, MessageBuffer& buffer);
+    void WriteSharedPacketToBuffer(SharedWorldPacket const& packet, bool encrypt, MessageBuffer& buffer);
     uint32 CompressPacket(uint8* buffer, WorldPacket const& packet);
 
     void HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession);
@@ -47,6 +47,7 @@
 #include "CreatureGroups.h"
 #include "CreatureTextMgr.h"
 #include "DB2Stores.h"
+#include "DBUpdater.h"
 #include "DatabaseEnv.h"
 #include "DetourMemoryFunctions.h"
 #include "DisableMgr.h"
@@ -87,11 +88,14 @@
 #include "ScenarioMgr.h"
 #include "ScriptMgr.h"
 #include "ScriptReloadMgr.h"
+#include "SharedWorldPacket.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
 #include "SmartScriptMgr.h"
 #include "SpellMgr.h"
+#include "StartupSnapshot.h"
 #include "SupportMgr.h"
+#include "TaskGraph.h"
 #include "TaxiPathGraph.h"
 #include "TerrainMgr.h"
 #include "TraitMgr.h"
@@ -106,6 +110,7 @@
 #include "WhoListStorage.h"
 #include "WorldSession.h"
 #include "WorldStateMgr.h"
+#include <fmt/ranges.h>
 #include <zlib.h>
 
 TC_GAME_API std::atomic<bool> World::m_stopEvent(false);
@@ -653,6 +658,7 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "OffhandCheckAtSpellUnlearn"sv, .DefaultValue = true, .Index = CONFIG_OFFHAND_CHECK_AT_SPELL_UNLEARN },
         { .Name = "Respawn.DynamicEscortNPC"sv, .DefaultValue = false, .Index = CONFIG_RESPAWN_DYNAMIC_ESCORTNPC },
         { .Name = "mmap.enablePathFinding"sv, .DefaultValue = true, .Index = CONFIG_ENABLE_MMAPS },
+        { .Name = "MapFiles.MemoryMapped"sv, .DefaultValue = false, .Index = CONFIG_MEMORY_MAPPED_MAP_FILES, .Reloadable = false },
         { .Name = "vmap.enableIndoorCheck"sv, .DefaultValue = true, .Index = CONFIG_VMAP_INDOOR_CHECK },
         { .Name = "PlayerStart.AllSpells"sv, .DefaultValue = false, .Index = CONFIG_START_ALL_SPELLS },
         { .Name = "ResetDuelCooldowns"sv, .DefaultValue = false, .Index = CONFIG_RESET_DUEL_COOLDOWNS },
@@ -693,6 +699,7 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "AllowLoggingIPAddressesInDatabase"sv, .DefaultValue = true, .Index = CONFIG_ALLOW_LOGGING_IP_ADDRESSES_IN_DATABASE },
         { .Name = "Loot.EnableAELoot"sv, .DefaultValue = true, .Index = CONFIG_ENABLE_AE_LOOT },
         { .Name = "Load.Locales"sv, .DefaultValue = true, .Index = CONFIG_LOAD_LOCALES },
+        { .Name = "Visibility.Incremental.Enable"sv, .DefaultValue = false, .Index = CONFIG_VISIBILITY_INCREMENTAL },
     } };
 
     static constexpr ConfigOptionLoadDefinitionArray<uint32, INT_CONFIG_VALUE_COUNT> ints =
@@ -859,6 +866,11 @@ void World::LoadConfigSettings(bool reload)
         { .Name = "PvPToken.ItemID"sv, .DefaultValue = 29434, .Index = CONFIG_PVP_TOKEN_ID },
         { .Name = "PvPToken.ItemCount"sv, .DefaultValue = 1, .Index = CONFIG_PVP_TOKEN_COUNT, .Min = 1 },
         { .Name = "MapUpdate.Threads"sv, .DefaultValue = 1, .Index = CONFIG_NUMTHREADS, .Min = 1 },
+        { .Name = "MapUpdate.PathfindingThreads"sv, .DefaultValue = 0, .Index = CONFIG_MAP_UPDATE_PATHFINDING_THREADS },
+        { .Name = "mmap.PathCacheSize"sv, .DefaultValue = 512, .Index = CONFIG_MMAP_PATH_CACHE_SIZE, .Reloadable = false },
+        { .Name = "MapFiles.PrefetchThreads"sv, .DefaultValue = 0, .Index = CONFIG_MAP_FILES_PREFETCH_THREADS, .Reloadable = false },
+        { .Name = "Startup.LoadThreads"sv, .DefaultValue = 0, .Index = CONFIG_STARTUP_LOAD_THREADS, .Reloadable = false },
+        { .Name = "Visibility.Incremental.FullRescanInterval"sv, .DefaultValue = 5, .Index = CONFIG_VISIBILITY_INCREMENTAL_FULL_RESCAN_INTERVAL },
         { .Name = "Command.LookupMaxResults"sv, .DefaultValue = 0, .Index = CONFIG_MAX_RESULTS_LOOKUP_COMMANDS },
         { .Name = "Warden.NumInjectionChecks"sv, .DefaultValue = 9, .Index = CONFIG_WARDEN_NUM_INJECT_CHECKS },
         { .Name = "Warden.NumLuaSandboxChecks"sv, .DefaultValue = 1, .Index = CONFIG_WARDEN_NUM_LUA_CHECKS },
@@ -1277,6 +1289,13 @@ bool World::SetInitialWorldSettings()
     ///- Initialize game event manager
     sGameEventMgr->Initialize();
 
+    ///- Initialize startup snapshots of world database stores, must be before loading any of them
+    std::string snapshotDirectory = sConfigMgr->GetStringDefault("StartupSnapshot.Directory"sv, ""sv);
+    // templates and spawns are also checked against db2 data, changed by hotfix database updates and DBC.Locale
+    sStartupSnapshot->Initialize(snapshotDirectory, snapshotDirectory.empty() ? std::string() :
+        Trinity::StringFormat("{}-{}-{}-{}", GitRevision::GetHash(), DBUpdater<WorldDatabaseConnection>::GetAppliedUpdatesHash(WorldDatabase),
+            DBUpdater<HotfixDatabaseConnection>::GetAppliedUpdatesHash(HotfixDatabase), localeNames[GetDefaultDbcLocale()]));
+
     ///- Loading strings. Getting no records means core load has to be canceled because no error message can be output.
 
     TC_LOG_INFO("server.loading", "Loading Trinity strings...");
@@ -1348,10 +1367,13 @@ bool World::SetInitialWorldSettings()
     }
 
     sTerrainMgr.InitializeParentMapData(mapData);
+    sTerrainMgr.InitializePrefetch(m_int_configs[CONFIG_MAP_FILES_PREFETCH_THREADS]);
 
     vmmgr2->InitializeThreadUnsafe(mapData);
 
     MMAP::MMapManager* mmmgr = MMAP::MMapFactory::createOrGetMMapManager();
+    mmmgr->SetUseMemoryMappedFiles(m_bool_configs[CONFIG_MEMORY_MAPPED_MAP_FILES]);
+    mmmgr->SetPathCacheSize(m_int_configs[CONFIG_MMAP_PATH_CACHE_SIZE]);
     mmmgr->InitializeThreadUnsafe(mapData);
 
     ///- Initialize static helper structures
@@ -1407,144 +1429,287 @@ bool World::SetInitialWorldSettings()
     sMapMgr->InitInstanceIds();
     sInstanceLockMgr.Load();
 
-    TC_LOG_INFO("server.loading", "Loading Localization strings...");
-    uint32 oldMSTime = getMSTime();
-    if (m_bool_configs[CONFIG_LOAD_LOCALES])
-    {
-        sObjectMgr->LoadCreatureLocales();
-        sObjectMgr->LoadGameObjectLocales();
-        sObjectMgr->LoadQuestTemplateLocale();
-        sObjectMgr->LoadQuestOfferRewardLocale();
-        sObjectMgr->LoadQuestRequestItemsLocale();
-        sObjectMgr->LoadQuestObjectivesLocale();
-        sObjectMgr->LoadPageTextLocales();
-        sObjectMgr->LoadGossipMenuItemsLocales();
-        sObjectMgr->LoadPointOfInterestLocales();
-    }
+    uint32 startupLoadThreads = m_int_configs[CONFIG_STARTUP_LOAD_THREADS];
+    if (!startupLoadThreads)
+        startupLoadThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    // loaders are bound by world database queries, each thread gets its own connection until loot is loaded
+    uint32 loaderThreads = std::clamp<uint32>(WorldDatabase.ReserveSynchConnections(uint8(std::min<uint32>(startupLoadThreads, std::numeric_limits<uint8>::max()))), 1, startupLoadThreads);
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    TC_LOG_INFO("server.loading", ">> Localization strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
 
-    TC_LOG_INFO("server.loading", "Loading Account Roles and Permissions...");
-    sAccountMgr->LoadRBAC();
+    {
+        // loaders only filling their own containers, each task must declare the tasks whose data it reads or modifies
+        // tasks calling ObjectMgr::GetScriptId may run concurrently, script ids are assigned under a lock
+        Trinity::TaskGraph loaders;
+        if (m_bool_configs[CONFIG_LOAD_LOCALES])
+        {
+            loaders.AddTask("creature locales", []() { sObjectMgr->LoadCreatureLocales(); });
+            loaders.AddTask("gameobject locales", []() { sObjectMgr->LoadGameObjectLocales(); });
+            loaders.AddTask("quest template locales", []() { sObjectMgr->LoadQuestTemplateLocale(); });
+            loaders.AddTask("quest offer reward locales", []() { sObjectMgr->LoadQuestOfferRewardLocale(); });
+            loaders.AddTask("quest request items locales", []() { sObjectMgr->LoadQuestRequestItemsLocale(); });
+            loaders.AddTask("quest objectives locales", []() { sObjectMgr->LoadQuestObjectivesLocale(); });
+            loaders.AddTask("page text locales", []() { sObjectMgr->LoadPageTextLocales(); });
+            loaders.AddTask("gossip menu items locales", []() { sObjectMgr->LoadGossipMenuItemsLocales(); });
+            loaders.AddTask("point of interest locales", []() { sObjectMgr->LoadPointOfInterestLocales(); });
+        }
+
+        loaders.AddTask("rbac", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Account Roles and Permissions...");
+            sAccountMgr->LoadRBAC();
+        });
+
+        Trinity::TaskGraph::TaskId pageTexts = loaders.AddTask("page texts", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Page Texts...");
+            sObjectMgr->LoadPageTexts();
+        });
+
+        Trinity::TaskGraph::TaskId destructibleHitpoints = loaders.AddTask("destructible hitpoints", []() { sObjectMgr->LoadDestructibleHitpoints(); });
 
-    TC_LOG_INFO("server.loading", "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
+        Trinity::TaskGraph::TaskId gameObjectTemplates = loaders.AddTask("gameobject templates", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Game Object Templates...");
+            sStartupSnapshot->Load(ObjectMgr::GameObjectTemplateSnapshotName, ObjectMgr::GameObjectTemplateSnapshotVersion,
+                [] { sObjectMgr->LoadGameObjectTemplate(); },
+                [](ByteBuffer& data) { sObjectMgr->WriteGameObjectTemplateSnapshot(data); },
+                [](StartupSnapshotReader& data) { sObjectMgr->ReadGameObjectTemplateSnapshot(data); });
+        }, { pageTexts, destructibleHitpoints });
+
+        loaders.AddTask("gameobject template addons", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Game Object template addons...");
+            sObjectMgr->LoadGameObjectTemplateAddons();
+        }, { gameObjectTemplates });
 
-    TC_LOG_INFO("server.loading", "Loading Game Object Templates...");         // must be after LoadPageTexts
-    sObjectMgr->LoadDestructibleHitpoints();
-    sObjectMgr->LoadGameObjectTemplate();
+        loaders.AddTask("transports", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Transport templates...");
+            sTransportMgr->LoadTransportTemplates();
 
-    TC_LOG_INFO("server.loading", "Loading Game Object template addons...");
-    sObjectMgr->LoadGameObjectTemplateAddons();
+            TC_LOG_INFO("server.loading", "Loading Transport animations and rotations...");
+            sTransportMgr->LoadTransportAnimationAndRotation();
 
-    TC_LOG_INFO("server.loading", "Loading Transport templates...");
-    sTransportMgr->LoadTransportTemplates();
+            TC_LOG_INFO("server.loading", "Loading Transport spawns...");
+            sTransportMgr->LoadTransportSpawns();
+        }, { gameObjectTemplates });
 
-    TC_LOG_INFO("server.loading", "Loading Transport animations and rotations...");
-    sTransportMgr->LoadTransportAnimationAndRotation();
+        // spell ranks and SpellSpecific/AuraState are written into SpellInfo, everything reading spell data beyond its existence waits for them
+        Trinity::TaskGraph::TaskId spellRanks = loaders.AddTask("spell ranks", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Spell Rank Data...");
+            sSpellMgr->LoadSpellRanks();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Transport spawns...");
-    sTransportMgr->LoadTransportSpawns();
+        Trinity::TaskGraph::TaskId spellSpecific = loaders.AddTask("spell specific and aura state", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading SpellInfo SpellSpecific and AuraState...");
+            sSpellMgr->LoadSpellInfoSpellSpecificAndAuraState();
+        }, { spellRanks });
 
-    TC_LOG_INFO("server.loading", "Loading Spell Rank Data...");
-    sSpellMgr->LoadSpellRanks();
+        loaders.AddTask("spell required", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Spell Required Data...");
+            sSpellMgr->LoadSpellRequired();
+        }, { spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
+        Trinity::TaskGraph::TaskId spellGroups = loaders.AddTask("spell groups", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Spell Group types...");
+            sSpellMgr->LoadSpellGroups();
+        }, { spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading Spell Group types...");
-    sSpellMgr->LoadSpellGroups();
+        loaders.AddTask("spell learn skills", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Spell Learn Skills...");
+            sSpellMgr->LoadSpellLearnSkills();
+        }, { spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
+        loaders.AddTask("spell learn spells", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Spell Learn Spells...");
+            sSpellMgr->LoadSpellLearnSpells();
+        }, { spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading SpellInfo SpellSpecific and AuraState...");
-    sSpellMgr->LoadSpellInfoSpellSpecificAndAuraState();         // must be after LoadSpellRanks
+        loaders.AddTask("spell procs", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Spell Proc conditions and data...");
+            sSpellMgr->LoadSpellProcs();
+        }, { spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading Spell Learn Spells...");
-    sSpellMgr->LoadSpellLearnSpells();
+        loaders.AddTask("spell threats", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Aggro Spells Definitions...");
+            sSpellMgr->LoadSpellThreats();
+        }, { spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading Spell Proc conditions and data...");
-    sSpellMgr->LoadSpellProcs();
+        loaders.AddTask("spell group stack rules", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
+            sSpellMgr->LoadSpellGroupStackRules();
+        }, { spellGroups });
 
-    TC_LOG_INFO("server.loading", "Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
+        loaders.AddTask("spell enchant proc data", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Enchant Spells Proc datas...");
+            sSpellMgr->LoadSpellEnchantProcData();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
+        loaders.AddTask("pet levelup spells", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading pet levelup spells...");
+            sSpellMgr->LoadPetLevelupSpellMap();
+        }, { spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading NPC Texts...");
-    sObjectMgr->LoadNPCText();
+        loaders.AddTask("npc texts", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading NPC Texts...");
+            sObjectMgr->LoadNPCText();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Enchant Spells Proc datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
+        Trinity::TaskGraph::TaskId itemBonuses = loaders.AddTask("item bonuses", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading item bonus data...");
+            ItemBonusMgr::Load();
 
-    TC_LOG_INFO("server.loading", "Loading item bonus data...");
-    ItemBonusMgr::Load();
+            TC_LOG_INFO("server.loading", "Loading Random item bonus list definitions...");
+            LoadItemRandomBonusListTemplates();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Random item bonus list definitions...");
-    LoadItemRandomBonusListTemplates();
+        Trinity::TaskGraph::TaskId disables = loaders.AddTask("disables", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Disables");
+            DisableMgr::LoadDisables();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Disables");                         // must be before loading quests and items
-    DisableMgr::LoadDisables();
+        // addons and script names are written into item templates
+        loaders.AddTask("item templates", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Items...");
+            sObjectMgr->LoadItemTemplates();
 
-    TC_LOG_INFO("server.loading", "Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr->LoadItemTemplates();
+            TC_LOG_INFO("server.loading", "Loading Item set names...");
+            sObjectMgr->LoadItemTemplateAddon();
 
-    TC_LOG_INFO("server.loading", "Loading Item set names...");                // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemTemplateAddon();
+            TC_LOG_INFO("misc", "Loading Item Scripts...");
+            sObjectMgr->LoadItemScriptNames();
+        }, { pageTexts, itemBonuses, disables });
 
-    TC_LOG_INFO("misc", "Loading Item Scripts...");                 // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemScriptNames();
+        Trinity::TaskGraph::TaskId creatureModels = loaders.AddTask("creature models", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Creature Model Based Info Data...");
+            sObjectMgr->LoadCreatureModelInfo();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Creature Model Based Info Data...");
-    sObjectMgr->LoadCreatureModelInfo();
+        // difficulty data is written into creature templates
+        Trinity::TaskGraph::TaskId creatureTemplates = loaders.AddTask("creature templates", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Creature templates...");
+            sStartupSnapshot->Load(ObjectMgr::CreatureTemplateSnapshotName, ObjectMgr::CreatureTemplateSnapshotVersion,
+                []
+                {
+                    sObjectMgr->LoadCreatureTemplates();
 
-    TC_LOG_INFO("server.loading", "Loading Creature templates...");
-    sObjectMgr->LoadCreatureTemplates();
+                    TC_LOG_INFO("server.loading", "Loading Creature template difficulty...");
+                    sObjectMgr->LoadCreatureTemplateDifficulty();
+                },
+                [](ByteBuffer& data) { sObjectMgr->WriteCreatureTemplateSnapshot(data); },
+                [](StartupSnapshotReader& data) { sObjectMgr->ReadCreatureTemplateSnapshot(data); });
+        }, { creatureModels });
 
-    TC_LOG_INFO("server.loading", "Loading Equipment templates...");           // must be after LoadCreatureTemplates
-    sObjectMgr->LoadEquipmentTemplates();
+        Trinity::TaskGraph::TaskId equipmentTemplates = loaders.AddTask("equipment templates", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Equipment templates...");
+            sObjectMgr->LoadEquipmentTemplates();
+        }, { creatureTemplates });
 
-    TC_LOG_INFO("server.loading", "Loading Creature template addons...");
-    sObjectMgr->LoadCreatureTemplateAddons();
+        loaders.AddTask("creature template addons", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Creature template addons...");
+            sObjectMgr->LoadCreatureTemplateAddons();
+        }, { creatureTemplates, spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading Creature template difficulty...");
-    sObjectMgr->LoadCreatureTemplateDifficulty();
+        loaders.AddTask("creature template sparring", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Creature template sparring...");
+            sObjectMgr->LoadCreatureTemplateSparring();
+        }, { creatureTemplates });
 
-    TC_LOG_INFO("server.loading", "Loading Creature template sparring...");
-    sObjectMgr->LoadCreatureTemplateSparring();
+        loaders.AddTask("reputation", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Reputation Reward Rates...");
+            sObjectMgr->LoadReputationRewardRate();
 
-    TC_LOG_INFO("server.loading", "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
+            TC_LOG_INFO("server.loading", "Loading Creature Reputation OnKill Data...");
+            sObjectMgr->LoadReputationOnKill();
 
-    TC_LOG_INFO("server.loading", "Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
+            TC_LOG_INFO("server.loading", "Loading Reputation Spillover Data...");
+            sObjectMgr->LoadReputationSpilloverTemplate();
+        }, { creatureTemplates });
 
-    TC_LOG_INFO("server.loading", "Loading Reputation Spillover Data...");
-    sObjectMgr->LoadReputationSpilloverTemplate();
+        loaders.AddTask("points of interest", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Points Of Interest Data...");
+            sObjectMgr->LoadPointsOfInterest();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
+        loaders.AddTask("creature base stats", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Creature Base Stats...");
+            sObjectMgr->LoadCreatureClassLevelStats();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
+        Trinity::TaskGraph::TaskId spawnGroupTemplates = loaders.AddTask("spawn group templates", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Spawn Group Templates...");
+            sObjectMgr->LoadSpawnGroupTemplates();
+        });
 
-    TC_LOG_INFO("server.loading", "Loading Spawn Group Templates...");
-    sObjectMgr->LoadSpawnGroupTemplates();
+        // both add spawns to the shared cell index and load terrain for zone lookups, they must not run concurrently
+        Trinity::TaskGraph::TaskId creatures = loaders.AddTask("creatures", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Creature Data...");
+            // zone and area calculation writes to database while loading
+            if (sWorld->getBoolConfig(CONFIG_CALCULATE_CREATURE_ZONE_AREA_DATA))
+                sObjectMgr->LoadCreatures();
+            else
+                sStartupSnapshot->Load(ObjectMgr::CreatureSnapshotName, ObjectMgr::CreatureSnapshotVersion,
+                    [] { sObjectMgr->LoadCreatures(); },
+                    [](ByteBuffer& data) { sObjectMgr->WriteCreatureSnapshot(data); },
+                    [](StartupSnapshotReader& data) { sObjectMgr->ReadCreatureSnapshot(data); });
+        }, { creatureModels, creatureTemplates, equipmentTemplates, gameObjectTemplates, spawnGroupTemplates });
 
-    TC_LOG_INFO("server.loading", "Loading Creature Data...");
-    sObjectMgr->LoadCreatures();
+        loaders.AddTask("gameobjects", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Gameobject Data...");
+            if (sWorld->getBoolConfig(CONFIG_CALCULATE_GAMEOBJECT_ZONE_AREA_DATA))
+                sObjectMgr->LoadGameObjects();
+            else
+                sStartupSnapshot->Load(ObjectMgr::GameObjectSnapshotName, ObjectMgr::GameObjectSnapshotVersion,
+                    [] { sObjectMgr->LoadGameObjects(); },
+                    [](ByteBuffer& data) { sObjectMgr->WriteGameObjectSnapshot(data); },
+                    [](StartupSnapshotReader& data) { sObjectMgr->ReadGameObjectSnapshot(data); });
+        }, { creatures, gameObjectTemplates, spawnGroupTemplates });
 
-    TC_LOG_INFO("server.loading", "Loading Temporary Summon Data...");
-    sObjectMgr->LoadTempSummons();                               // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
+        loaders.AddTask("temporary summons", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading Temporary Summon Data...");
+            sObjectMgr->LoadTempSummons();
+        }, { creatureTemplates, gameObjectTemplates });
 
-    TC_LOG_INFO("server.loading", "Loading pet levelup spells...");
-    sSpellMgr->LoadPetLevelupSpellMap();
+        loaders.AddTask("pet default spells", []()
+        {
+            TC_LOG_INFO("server.loading", "Loading pet default spells additional to levelup spells...");
+            sSpellMgr->LoadPetDefaultSpells();
+        }, { creatureTemplates, spellSpecific });
 
-    TC_LOG_INFO("server.loading", "Loading pet default spells additional to levelup spells...");
-    sSpellMgr->LoadPetDefaultSpells();
+        TC_LOG_INFO("server.loading", "Loading Localization strings, templates, spawns and spell data...");
+        Trinity::TaskGraph::Timings timings = loaders.Run(loaderThreads);
+        TC_LOG_INFO("server.loading", ">> Startup loaders finished in {} ms ({} ms one after another) using {} threads, critical path {} ms ({})",
+            timings.Total.count(), timings.Serial.count(), loaderThreads, timings.CriticalPath.count(), fmt::join(timings.CriticalPathTasks, " -> "));
+    }
 
     TC_LOG_INFO("server.loading", "Loading Creature Addon Data...");
     sObjectMgr->LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
@@ -1552,9 +1717,6 @@ bool World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Loading Creature Movement Overrides...");
     sObjectMgr->LoadCreatureMovementOverrides();                 // must be after LoadCreatures()
 
-    TC_LOG_INFO("server.loading", "Loading Gameobject Data...");
-    sObjectMgr->LoadGameObjects();
-
     TC_LOG_INFO("server.loading", "Loading Spawn Group Data...");
     sObjectMgr->LoadSpawnGroups();
 
@@ -1731,7 +1893,8 @@ bool World::SetInitialWorldSettings()
     sObjectMgr->LoadMailLevelRewards();
 
     // Loot tables
-    LoadLootTables();
+    LoadLootTables(loaderThreads);
+    WorldDatabase.ReleaseSynchConnections();
 
     TC_LOG_INFO("server.loading", "Loading Skill Discovery Table...");
     LoadSkillDiscoveryTable();
@@ -1832,7 +1995,10 @@ bool World::SetInitialWorldSettings()
     sObjectMgr->LoadVendors();                                  // must be after load CreatureTemplate and ItemTemplate
 
     TC_LOG_INFO("server.loading", "Loading Waypoint paths...");
-    sWaypointMgr->LoadPaths();
+    sStartupSnapshot->Load(WaypointMgr::SnapshotName, WaypointMgr::SnapshotVersion,
+        [] { sWaypointMgr->LoadPaths(); },
+        [](ByteBuffer& data) { sWaypointMgr->WriteSnapshot(data); },
+        [](StartupSnapshotReader& data) { sWaypointMgr->ReadSnapshot(data); });
 
     TC_LOG_INFO("server.loading", "Loading Creature Formations...");
     sFormationMgr->LoadCreatureFormations();
@@ -2126,6 +2292,7 @@ void World::LoadAutobroadcasts()
 void World::Update(uint32 diff)
 {
     TC_METRIC_TIMER("world_update_time_total");
+    TC_METRIC_HISTOGRAM_TIMER("trinity_world_update_duration_seconds", "Duration of world update ticks");
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
     time_t currentGameTime = GameTime::GetGameTime();
@@ -2430,6 +2597,18 @@ void World::Update(uint32 diff)
         // Stats logger update
         sMetric->Update();
         TC_METRIC_VALUE("update_time_diff", diff);
+
+        WorldPacketSendStatistics packetSendStatistics = WorldPacketSendStatistics::Consume();
+        TC_METRIC_VALUE("packet_copied_bytes", packetSendStatistics.CopiedBytes);
+        TC_METRIC_VALUE("packet_compressed_bytes", packetSendStatistics.CompressedBytes);
+        TC_METRIC_VALUE("packet_shared_sends", packetSendStatistics.SharedSends);
+
+        MMAP::PathCacheStatistics pathCacheStatistics = MMAP::PathCache::ConsumeStatistics();
+        TC_METRIC_VALUE("mmap_path_cache_hits", pathCacheStatistics.Hits);
+        TC_METRIC_VALUE("mmap_path_cache_misses", pathCacheStatistics.Misses);
+
+        PlayerSaveStatistics playerSaveStatistics = PlayerSaveStatistics::Consume();
+        TC_METRIC_VALUE("player_save_skipped_statements", playerSaveStatistics.SkippedStatements);
     }
 }
 
@@ -165,6 +165,7 @@ enum WorldBoolConfigs : uint32
     CONFIG_QUEST_ENABLE_QUEST_TRACKER,
     CONFIG_WARDEN_ENABLED,
     CONFIG_ENABLE_MMAPS,
+    CONFIG_MEMORY_MAPPED_MAP_FILES,
     CONFIG_WINTERGRASP_ENABLE,
     CONFIG_TOLBARAD_ENABLE,
     CONFIG_EVENT_ANNOUNCE,
@@ -197,6 +198,7 @@ enum WorldBoolConfigs : uint32
     CONFIG_BATTLEGROUNDMAP_LOAD_GRIDS,
     CONFIG_ENABLE_AE_LOOT,
     CONFIG_LOAD_LOCALES,
+    CONFIG_VISIBILITY_INCREMENTAL,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -351,6 +353,11 @@ enum WorldIntConfigs : uint32
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAP_UPDATE_PATHFINDING_THREADS,
+    CONFIG_MMAP_PATH_CACHE_SIZE,
+    CONFIG_MAP_FILES_PREFETCH_THREADS,
+    CONFIG_STARTUP_LOAD_THREADS,
+    CONFIG_VISIBILITY_INCREMENTAL_FULL_RESCAN_INTERVAL,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_CLIENTCACHE_VERSION,
@@ -119,8 +119,7 @@ public:
         bool first = true;
         bool footer = false;
 
-        std::shared_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
-        for (auto&& [playerGuid, player] : ObjectAccessor::GetPlayers())
+        ObjectAccessor::DoForAllPlayers([&](Player* player)
         {
             AccountTypes playerSec = player->GetSession()->GetSecurity();
             if ((player->IsGameMaster() ||
@@ -147,7 +146,7 @@ public:
                 else
                     handler->PSendSysMessage("|%*s%s%*s|   %u  |", max, " ", name.c_str(), max2, " ", security);
             }
-        }
+        });
         if (footer)
             handler->SendSysMessage("========================");
         if (first)
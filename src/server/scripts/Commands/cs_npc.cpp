@@ -46,6 +46,7 @@ EndScriptData */
 #include "RBAC.h"
 #include "SmartEnum.h"
 #include "SpellMgr.h"
+#include "StartupSnapshot.h"
 #include "Transport.h"
 #include "World.h"
 #include "WorldSession.h"
@@ -233,6 +234,7 @@ public:
         stmt->setUInt64(1, lowGuid);
 
         WorldDatabase.Execute(stmt);
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureSnapshotName);
 
         handler->SendSysMessage(LANG_WAYPOINT_ADDED);
 
@@ -399,6 +401,7 @@ public:
         stmt->setUInt32(1, creature->GetEntry());
 
         WorldDatabase.Execute(stmt);
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureTemplateSnapshotName);
 
         return true;
     }
@@ -424,6 +427,7 @@ public:
         stmt->setUInt32(1, creature->GetEntry());
 
         WorldDatabase.Execute(stmt);
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureTemplateSnapshotName);
 
         handler->SendSysMessage(LANG_VALUE_SAVED_REJOIN);
 
@@ -655,6 +659,7 @@ public:
         stmt->setFloat(3, player->GetOrientation());
         stmt->setUInt64(4, lowguid);
         WorldDatabase.Execute(stmt);
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureSnapshotName);
 
         // respawn selected creature at the new location
         if (creature)
@@ -905,6 +910,7 @@ public:
         stmt->setUInt64(2, guidLow);
 
         WorldDatabase.Execute(stmt);
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureSnapshotName);
 
         handler->PSendSysMessage(LANG_COMMAND_WANDER_DISTANCE, option);
         return true;
@@ -921,6 +927,7 @@ public:
         stmt->setUInt32(0, spawnTime);
         stmt->setUInt64(1, creature->GetSpawnId());
         WorldDatabase.Execute(stmt);
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureSnapshotName);
 
         creature->SetRespawnDelay(spawnTime);
         handler->PSendSysMessage(LANG_COMMAND_SPAWNTIME, spawnTime);
@@ -46,6 +46,7 @@ EndScriptData */
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "StartupSnapshot.h"
 #include "StringConvert.h"
 #include "SupportMgr.h"
 #include "WaypointManager.h"
@@ -458,6 +459,7 @@ public:
 
         sObjectMgr->InitializeQueriesData(QUERY_DATA_CREATURES);
         sScriptMgr->NotifyScriptIDUpdate();
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureTemplateSnapshotName);
         handler->SendGlobalGMSysMessage("Creature template reloaded.");
         return true;
     }
@@ -911,6 +913,7 @@ public:
             TC_LOG_INFO("misc", "Re-Loading Waypoints data from 'waypoint_path' and 'waypoint_path_node'");
 
         sWaypointMgr->LoadPaths();
+        sWaypointMgr->InvalidateSnapshot();
 
         if (*args != 'a')
             handler->SendGlobalGMSysMessage("DB Tables 'waypoint_path' and 'waypoint_path_node' reloaded.");
@@ -34,6 +34,7 @@ EndScriptData */
 #include "PhasingHandler.h"
 #include "Player.h"
 #include "RBAC.h"
+#include "StartupSnapshot.h"
 #include "WaypointManager.h"
 
 using namespace Trinity::ChatCommands;
@@ -136,6 +137,8 @@ public:
         stmt->setFloat(5, player->GetOrientation());
         WorldDatabase.Execute(stmt);
 
+        sWaypointMgr->InvalidateSnapshot();
+
         if (target)
         {
             uint32 displayId = target->GetDisplayId();
@@ -206,6 +209,7 @@ public:
         stmt->setUInt8(0, uint8(WAYPOINT_MOTION_TYPE));
         stmt->setUInt64(1, guidLow);
         WorldDatabase.Execute(stmt);
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureSnapshotName);
 
         target->LoadPath(pathid);
         target->SetDefaultMovementType(WAYPOINT_MOTION_TYPE);
@@ -260,6 +264,7 @@ public:
         stmt->setUInt8(0, uint8(IDLE_MOTION_TYPE));
         stmt->setUInt64(1, guidLow);
         WorldDatabase.Execute(stmt);
+        sStartupSnapshot->Invalidate(ObjectMgr::CreatureSnapshotName);
 
         target->LoadPath(0);
         target->SetDefaultMovementType(IDLE_MOTION_TYPE);
@@ -97,13 +97,13 @@ void ByteBuffer::append(uint8 const* src, size_t cnt)
     if (_storage.capacity() < newSize) // custom memory allocation rules
     {
         if (newSize < 100)
-            _storage.reserve(300);
+            Reallocate(300);
         else if (newSize < 750)
-            _storage.reserve(2500);
+            Reallocate(2500);
         else if (newSize < 6000)
-            _storage.reserve(10000);
+            Reallocate(10000);
         else
-            _storage.reserve(400000);
+            Reallocate(400000);
     }
 
     if (_storage.size() < newSize)
@@ -112,6 +112,13 @@ void ByteBuffer::append(uint8 const* src, size_t cnt)
     _wpos = newSize;
 }
 
+void ByteBuffer::Reallocate(size_t capacity)
+{
+    std::vector<uint8> storage = Trinity::BufferPool::Acquire(capacity);
+    storage.assign(_storage.begin(), _storage.end());
+    Trinity::BufferPool::Release(std::exchange(_storage, std::move(storage)));
+}
+
 void ByteBuffer::put(size_t pos, uint8 const* src, size_t cnt)
 {
     ASSERT(pos + cnt <= size(), "Attempted to put value with size: " SZFMTD " in ByteBuffer (pos: " SZFMTD " size: " SZFMTD ")", cnt, pos, size());
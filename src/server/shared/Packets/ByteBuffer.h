@@ -18,11 +18,13 @@
 #ifndef TRINITYCORE_BYTE_BUFFER_H
 #define TRINITYCORE_BYTE_BUFFER_H
 
+#include "BufferPool.h"
 #include "ByteConverter.h"
 #include "Concepts.h"
 #include "Define.h"
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 #include <cstring>
 
@@ -72,9 +74,9 @@ class TC_SHARED_API ByteBuffer
         // constructor
         explicit ByteBuffer() : ByteBuffer(DEFAULT_SIZE, Reserve{}) { }
 
-        explicit ByteBuffer(size_t size, Reserve) : _rpos(0), _wpos(0), _bitpos(InitialBitPos), _curbitval(0)
+        explicit ByteBuffer(size_t size, Reserve) : _rpos(0), _wpos(0), _bitpos(InitialBitPos), _curbitval(0),
+            _storage(Trinity::BufferPool::Acquire(size))
         {
-            _storage.reserve(size);
         }
 
         explicit ByteBuffer(size_t size, Resize) : _rpos(0), _wpos(size), _bitpos(InitialBitPos), _curbitval(0)
@@ -82,7 +84,11 @@ class TC_SHARED_API ByteBuffer
             _storage.resize(size);
         }
 
-        ByteBuffer(ByteBuffer const& right) = default;
+        ByteBuffer(ByteBuffer const& right) : _rpos(right._rpos), _wpos(right._wpos),
+            _bitpos(right._bitpos), _curbitval(right._curbitval), _storage(Trinity::BufferPool::Acquire(right._storage.size()))
+        {
+            _storage.assign(right._storage.begin(), right._storage.end());
+        }
 
         ByteBuffer(ByteBuffer&& buf) noexcept : _rpos(buf._rpos), _wpos(buf._wpos),
             _bitpos(buf._bitpos), _curbitval(buf._curbitval), _storage(std::move(buf).Release()) { }
@@ -109,13 +115,16 @@ class TC_SHARED_API ByteBuffer
                 _wpos = right._wpos;
                 _bitpos = right._bitpos;
                 _curbitval = right._curbitval;
-                _storage = std::move(right).Release();
+                Trinity::BufferPool::Release(std::exchange(_storage, std::move(right).Release()));
             }
 
             return *this;
         }
 
-        virtual ~ByteBuffer() = default;
+        virtual ~ByteBuffer()
+        {
+            Trinity::BufferPool::Release(std::move(_storage));
+        }
 
         void clear()
         {
@@ -577,8 +586,8 @@ class TC_SHARED_API ByteBuffer
 
         void reserve(size_t ressize)
         {
-            if (ressize > _storage.size())
-                _storage.reserve(ressize);
+            if (ressize > _storage.capacity())
+                Reallocate(ressize);
         }
 
         void shrink_to_fit()
@@ -622,6 +631,9 @@ class TC_SHARED_API ByteBuffer
     protected:
         [[noreturn]] void OnInvalidPosition(size_t pos, size_t valueSize) const;
 
+        // moves contents to pooled storage of at least given capacity
+        void Reallocate(size_t capacity);
+
         size_t _rpos, _wpos;
         uint8 _bitpos;
         uint8 _curbitval;
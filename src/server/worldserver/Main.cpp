@@ -20,6 +20,7 @@
 #include "AsyncAcceptor.h"
 #include "AuthenticationPackets.h"
 #include "Banner.h"
+#include "BufferPool.h"
 #include "BattlegroundMgr.h"
 #include "BigNumber.h"
 #include "CliRunnable.h"
@@ -35,6 +36,7 @@
 #include "MapManager.h"
 #include "Memory.h"
 #include "Metric.h"
+#include "MetricsHttpService.h"
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvP/OutdoorPvPMgr.h"
@@ -226,6 +228,8 @@ int main(int argc, char** argv)
 
     std::shared_ptr<Trinity::Asio::IoContext> ioContext = std::make_shared<Trinity::Asio::IoContext>();
 
+    Trinity::BufferPool::SetDepotCapacity(std::size_t(std::max(sConfigMgr->GetIntDefault("Network.BufferPool.MaxRetainedMB", 16), 0)) * 1024 * 1024);
+
     sLog->RegisterAppender<AppenderDB>();
     // If logs are supposed to be handled async then we need to pass the IoContext into the Log singleton
     sLog->Initialize(sConfigMgr->GetBoolDefault("Log.Async.Enable", false) ? ioContext.get() : nullptr);
@@ -333,6 +337,25 @@ int main(int argc, char** argv)
         TC_METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        auto logBatchStatistics = []<typename T>(DatabaseWorkerPool<T>& pool, char const* database)
+        {
+            typename DatabaseWorkerPool<T>::BatchStatistics batchStatistics = pool.ConsumeBatchStatistics();
+            if (!batchStatistics.Batches)
+                return;
+
+            TC_METRIC_VALUE("db_batch_size", double(batchStatistics.Items) / batchStatistics.Batches, TC_METRIC_TAG("db", database));
+            TC_METRIC_VALUE("db_batch_time", std::chrono::nanoseconds(batchStatistics.ExecutionTime) / batchStatistics.Batches, TC_METRIC_TAG("db", database));
+        };
+        logBatchStatistics(LoginDatabase, "login");
+        logBatchStatistics(CharacterDatabase, "character");
+        logBatchStatistics(WorldDatabase, "world");
+
+        Trinity::BufferPool::Statistics bufferPoolStatistics = Trinity::BufferPool::GetStatistics();
+        TC_METRIC_VALUE("buffer_pool_allocations", bufferPoolStatistics.Allocations);
+        TC_METRIC_VALUE("buffer_pool_reuses", bufferPoolStatistics.Reuses);
+        TC_METRIC_VALUE("buffer_pool_discards", bufferPoolStatistics.Discards);
+        TC_METRIC_VALUE("buffer_pool_depot_bytes", bufferPoolStatistics.DepotBytes);
     });
 
     realm = nullptr;
@@ -382,6 +405,21 @@ int main(int argc, char** argv)
             return -1;
     }
 
+    // Start the metrics http endpoint if enabled
+    std::unique_ptr<Trinity::Metrics::MetricsHttpService, decltype(Trinity::unique_ptr_deleter<Trinity::Metrics::MetricsHttpService*, &Trinity::Metrics::MetricsHttpService::StopNetwork>())> metricsHttpHandle;
+    if (sConfigMgr->GetBoolDefault("Metrics.Http.Enable", false))
+    {
+        std::string metricsBindIp = sConfigMgr->GetStringDefault("Metrics.Http.BindIP", "127.0.0.1");
+        uint16 metricsPort = uint16(sConfigMgr->GetIntDefault("Metrics.Http.Port", 8090));
+        if (!sMetricsHttpService.StartNetwork(*ioContext, metricsBindIp, metricsPort))
+        {
+            TC_LOG_ERROR("server.worldserver", "Failed to initialize metrics http endpoint on {}:{}", metricsBindIp, metricsPort);
+            return 1;
+        }
+
+        metricsHttpHandle.reset(&sMetricsHttpService);
+    }
+
     // Launch the worldserver listener socket
     uint16 worldPort = uint16(sWorld->getIntConfig(CONFIG_PORT_WORLD));
     std::string worldListener = sConfigMgr->GetStringDefault("BindIP", "0.0.0.0");
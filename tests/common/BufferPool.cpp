@@ -0,0 +1,96 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "BufferPool.h"
+#include "MessageBuffer.h"
+
+using Trinity::BufferPool;
+
+TEST_CASE("BufferPool", "[BufferPool]")
+{
+    SECTION("Acquired buffers are large enough and empty")
+    {
+        std::vector<uint8> buffer = BufferPool::Acquire(300);
+        REQUIRE(buffer.empty());
+        REQUIRE(buffer.capacity() >= 300);
+        BufferPool::Release(std::move(buffer));
+    }
+
+    SECTION("Released buffers are reused")
+    {
+        std::vector<uint8> buffer = BufferPool::Acquire(1000);
+        buffer.resize(1000);
+        uint8 const* data = buffer.data();
+        BufferPool::Release(std::move(buffer));
+
+        BufferPool::Statistics before = BufferPool::GetStatistics();
+        std::vector<uint8> reused = BufferPool::Acquire(700);
+        BufferPool::Statistics after = BufferPool::GetStatistics();
+
+        REQUIRE(reused.data() == data);
+        REQUIRE(reused.empty());
+        REQUIRE(after.Reuses == before.Reuses + 1);
+        REQUIRE(after.Allocations == before.Allocations);
+        BufferPool::Release(std::move(reused));
+    }
+
+    SECTION("Oversized buffers are not pooled")
+    {
+        BufferPool::Statistics before = BufferPool::GetStatistics();
+        std::vector<uint8> buffer = BufferPool::Acquire(BufferPool::MaxClassSize * 2);
+        BufferPool::Release(std::move(buffer));
+        BufferPool::Statistics after = BufferPool::GetStatistics();
+
+        REQUIRE(after.Allocations == before.Allocations + 1);
+        REQUIRE(after.Discards == before.Discards + 1);
+    }
+
+    SECTION("Depot retains at most its capacity")
+    {
+        BufferPool::SetDepotCapacity(BufferPool::MaxClassSize * 3);
+
+        std::vector<std::vector<uint8>> buffers;
+        for (uint32 i = 0; i < 16; ++i)
+            buffers.push_back(BufferPool::Acquire(BufferPool::MaxClassSize));
+        for (std::vector<uint8>& buffer : buffers)
+            BufferPool::Release(std::move(buffer));
+
+        BufferPool::Statistics statistics = BufferPool::GetStatistics();
+        REQUIRE(statistics.DepotBytes > 0);
+        REQUIRE(statistics.DepotBytes <= BufferPool::MaxClassSize * 3);
+
+        BufferPool::SetDepotCapacity(0);
+        REQUIRE(BufferPool::GetStatistics().DepotBytes == 0);
+
+        BufferPool::SetDepotCapacity(BufferPool::DefaultDepotCapacity);
+    }
+
+    SECTION("Message buffers recycle their storage")
+    {
+        uint8 const* data;
+        {
+            MessageBuffer buffer(4096);
+            data = buffer.GetBasePointer();
+        }
+
+        MessageBuffer buffer(4096);
+        REQUIRE(buffer.GetBasePointer() == data);
+        REQUIRE(buffer.GetBufferSize() == 4096);
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Appender.h"
+#include "LogMessage.h"
+#include "LogRingBuffer.h"
+#include "Logger.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    template <typename... Args>
+    bool Write(LogRingBuffer& buffer, Logger const* logger, Trinity::FormatString<Args...> fmt, Args&&... args)
+    {
+        return buffer.Write(logger, "test", LOG_LEVEL_INFO, fmt, Trinity::MakeFormatArgs(args...));
+    }
+
+    template <typename... Args>
+    bool Write(LogRingBufferWriter& writer, Logger const* logger, Trinity::FormatString<Args...> fmt, Args&&... args)
+    {
+        return writer.Write(logger, "test", LOG_LEVEL_INFO, fmt, Trinity::MakeFormatArgs(args...));
+    }
+
+    class CollectingAppender : public Appender
+    {
+    public:
+        CollectingAppender() : Appender(0, "Collecting", LOG_LEVEL_TRACE) { }
+
+        AppenderType getType() const override { return AppenderType(0); }
+
+        std::vector<std::string> Messages;
+        std::atomic<uint32> Count = 0;
+
+    private:
+        void _write(LogMessage const* message) override
+        {
+            Messages.push_back(message->text);
+            ++Count;
+        }
+    };
+}
+
+TEST_CASE("LogRingBuffer", "[LogRingBuffer]")
+{
+    Logger const* logger = nullptr;
+    LogRingBuffer buffer(4);
+    std::vector<std::string> drained;
+    auto drain = [&] { return buffer.Drain([&](LogRingBuffer::Entry const& entry) { drained.emplace_back(entry.GetText()); }); };
+
+    SECTION("Entries are drained in write order across wrap around")
+    {
+        for (uint32 i = 0; i < 3; ++i)
+            REQUIRE(Write(buffer, logger, "message {}", i));
+        REQUIRE(drain() == 3);
+
+        for (uint32 i = 3; i < 7; ++i)
+            REQUIRE(Write(buffer, logger, "message {}", i));
+        REQUIRE(drain() == 4);
+
+        REQUIRE(drained == std::vector<std::string>{ "message 0", "message 1", "message 2", "message 3", "message 4", "message 5", "message 6" });
+        REQUIRE(buffer.IsEmpty());
+    }
+
+    SECTION("Full buffer rejects messages")
+    {
+        for (uint32 i = 0; i < 4; ++i)
+            REQUIRE(Write(buffer, logger, "message {}", i));
+        REQUIRE_FALSE(Write(buffer, logger, "message {}", 4));
+
+        drain();
+        REQUIRE(Write(buffer, logger, "message {}", 4));
+    }
+
+    SECTION("Long messages keep their full text")
+    {
+        std::string longText(LogRingBuffer::Entry::MaxTextLength + 100, 'x');
+        REQUIRE(Write(buffer, logger, "{}", longText));
+        REQUIRE(Write(buffer, logger, "short"));
+        drain();
+        REQUIRE(drained == std::vector<std::string>{ longText, "short" });
+    }
+
+    SECTION("Invalid format is left to the caller")
+    {
+        REQUIRE_FALSE(buffer.Write(logger, "test", LOG_LEVEL_INFO, "{} {}", Trinity::MakeFormatArgs(1)));
+        REQUIRE(buffer.IsEmpty());
+    }
+}
+
+TEST_CASE("LogRingBufferWriter", "[LogRingBuffer]")
+{
+    CollectingAppender appender;
+    Logger logger("test", LOG_LEVEL_TRACE);
+    logger.addAppender(&appender);
+
+    SECTION("Flush writes messages of every thread in per thread order")
+    {
+        LogRingBufferWriter writer(1024);
+        std::atomic<uint32> queued = 0;
+        auto producer = [&](uint32 thread)
+        {
+            for (uint32 i = 0; i < 100; ++i)
+                if (Write(writer, &logger, "{} {}", thread, i))
+                    ++queued;
+        };
+
+        std::thread first(producer, 0);
+        std::thread second(producer, 1);
+        first.join();
+        second.join();
+        writer.Flush();
+
+        REQUIRE(queued == 200);
+        REQUIRE(appender.Messages.size() == 200);
+        std::array<uint32, 2> next = { };
+        for (std::string const& message : appender.Messages)
+        {
+            uint32 thread = message[0] - '0';
+            REQUIRE(message == Trinity::StringFormat("{} {}", thread, next[thread]++));
+        }
+    }
+
+    SECTION("Background thread writes without flushing")
+    {
+        LogRingBufferWriter writer(16);
+        REQUIRE(Write(writer, &logger, "background"));
+
+        for (uint32 i = 0; i < 1000; ++i)
+        {
+            if (appender.Count)
+                break;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        writer.Flush();
+        REQUIRE(appender.Messages == std::vector<std::string>{ "background" });
+    }
+}
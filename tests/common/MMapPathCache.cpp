@@ -0,0 +1,104 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "MMapManager.h"
+#include <algorithm>
+#include <array>
+
+using MMAP::PathCache;
+using MMAP::PathCacheKey;
+
+namespace
+{
+PathCacheKey MakeKey(dtPolyRef startPoly, dtPolyRef endPoly, uint32 instanceId = 0, uint16 includeFlags = 1)
+{
+    return { 0, instanceId, startPoly, endPoly, includeFlags, 0 };
+}
+}
+
+TEST_CASE("MMAP::PathCache", "[PathCache]")
+{
+    PathCache cache(2);
+    std::array<dtPolyRef, 3> const path = { 10, 11, 12 };
+    std::array<dtPolyRef, 8> found = { };
+    int32 foundSize = 0;
+    dtStatus status = 0;
+    MMAP::PathCache::ConsumeStatistics();
+
+    SECTION("Inserted corridors are found")
+    {
+        cache.Insert(MakeKey(1, 2), path.data(), int32(path.size()), DT_SUCCESS | DT_PARTIAL_RESULT);
+        REQUIRE(cache.Find(MakeKey(1, 2), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE(foundSize == 3);
+        REQUIRE(std::equal(path.begin(), path.end(), found.begin()));
+        REQUIRE(status == (DT_SUCCESS | DT_PARTIAL_RESULT));
+
+        REQUIRE_FALSE(cache.Find(MakeKey(2, 1), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE_FALSE(cache.Find(MakeKey(1, 2, 1), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE_FALSE(cache.Find(MakeKey(1, 2, 0, 3), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE_FALSE(cache.Find(MakeKey(1, 2), found.data(), &foundSize, 2, &status));
+
+        MMAP::PathCacheStatistics statistics = MMAP::PathCache::ConsumeStatistics();
+        REQUIRE(statistics.Hits == 1);
+        REQUIRE(statistics.Misses == 4);
+    }
+
+    SECTION("Least recently used corridor is evicted")
+    {
+        cache.Insert(MakeKey(1, 2), path.data(), int32(path.size()), DT_SUCCESS);
+        cache.Insert(MakeKey(3, 4), path.data(), int32(path.size()), DT_SUCCESS);
+        REQUIRE(cache.Find(MakeKey(1, 2), found.data(), &foundSize, int32(found.size()), &status));
+
+        cache.Insert(MakeKey(5, 6), path.data(), 1, DT_SUCCESS);
+        REQUIRE(cache.Find(MakeKey(1, 2), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE_FALSE(cache.Find(MakeKey(3, 4), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE(cache.Find(MakeKey(5, 6), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE(foundSize == 1);
+    }
+
+    SECTION("Clear drops corridors through the tiles")
+    {
+        dtNavMesh navMesh;
+        auto poly = [&](uint32 tile, uint32 index) { return navMesh.encodePolyId(1, tile, index); };
+
+        PathCache tileCache(8);
+        std::array<dtPolyRef, 3> const throughTile = { poly(0, 1), poly(1, 4), poly(2, 7) };
+        std::array<dtPolyRef, 2> const insideTile = { poly(0, 1), poly(0, 2) };
+        std::array<dtPolyRef, 1> const partial = { poly(2, 7) };
+        tileCache.Insert(MakeKey(poly(0, 1), poly(2, 7)), throughTile.data(), int32(throughTile.size()), DT_SUCCESS);
+        tileCache.Insert(MakeKey(poly(0, 1), poly(0, 2)), insideTile.data(), int32(insideTile.size()), DT_SUCCESS);
+        tileCache.Insert(MakeKey(poly(2, 7), poly(3, 1)), partial.data(), int32(partial.size()), DT_SUCCESS | DT_PARTIAL_RESULT);
+
+        std::array<dtTileRef, 1> const removedTile = { navMesh.encodePolyId(1, 1, 0) };
+        tileCache.Clear(navMesh, removedTile, false);
+        REQUIRE_FALSE(tileCache.Find(MakeKey(poly(0, 1), poly(2, 7)), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE(tileCache.Find(MakeKey(poly(0, 1), poly(0, 2)), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE(tileCache.Find(MakeKey(poly(2, 7), poly(3, 1)), found.data(), &foundSize, int32(found.size()), &status));
+
+        // destination tile of the partial corridor is only known by its end polygon
+        std::array<dtTileRef, 1> const destinationTile = { navMesh.encodePolyId(1, 3, 0) };
+        tileCache.Clear(navMesh, destinationTile, false);
+        REQUIRE_FALSE(tileCache.Find(MakeKey(poly(2, 7), poly(3, 1)), found.data(), &foundSize, int32(found.size()), &status));
+
+        tileCache.Insert(MakeKey(poly(2, 7), poly(3, 1)), partial.data(), int32(partial.size()), DT_SUCCESS | DT_PARTIAL_RESULT);
+        std::array<dtTileRef, 1> const addedTile = { navMesh.encodePolyId(1, 5, 0) };
+        tileCache.Clear(navMesh, addedTile, true);
+        REQUIRE_FALSE(tileCache.Find(MakeKey(poly(2, 7), poly(3, 1)), found.data(), &foundSize, int32(found.size()), &status));
+        REQUIRE(tileCache.Find(MakeKey(poly(0, 1), poly(0, 2)), found.data(), &foundSize, int32(found.size()), &status));
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MetricsRegistry.h"
+#include <thread>
+
+using namespace Trinity::Metrics;
+
+TEST_CASE("Histogram buckets", "[Metrics]")
+{
+    SECTION("Bucket lower bounds round trip")
+    {
+        for (uint32 bucket = 0; bucket < Histogram::BucketCount; ++bucket)
+        {
+            uint64 lower = Histogram::GetBucketLowerBound(bucket);
+            REQUIRE(Histogram::GetBucket(lower) == bucket);
+            if (bucket + 1 < Histogram::BucketCount)
+                REQUIRE(Histogram::GetBucket(Histogram::GetBucketLowerBound(bucket + 1) - 1) == bucket);
+        }
+
+        REQUIRE(Histogram::GetBucket(Histogram::MaxValue) == Histogram::BucketCount - 1);
+        REQUIRE(Histogram::GetBucket(std::numeric_limits<uint64>::max()) == Histogram::BucketCount - 1);
+    }
+
+    SECTION("Quantiles are within bucket precision")
+    {
+        Histogram histogram;
+        for (uint64 i = 1; i <= 10000; ++i)
+            histogram.Record(Microseconds(i));
+
+        Histogram::Snapshot snapshot = histogram.GetSnapshot();
+        REQUIRE(snapshot.Count == 10000);
+        REQUIRE(snapshot.Sum == 10000 * 10001 / 2);
+
+        for (double quantile : { 0.5, 0.9, 0.99, 0.999 })
+        {
+            double expected = quantile * 10000;
+            double actual = double(snapshot.GetQuantile(quantile).count());
+            REQUIRE(std::abs(actual - expected) <= expected / Histogram::SubBucketCount);
+        }
+
+        REQUIRE(snapshot.GetCountAtOrBelow(1023) == 1023);
+    }
+
+    SECTION("Negative durations are recorded as zero")
+    {
+        Histogram histogram;
+        histogram.Record(Microseconds(-5));
+        REQUIRE(histogram.GetSnapshot().Buckets[0] == 1);
+    }
+}
+
+TEST_CASE("Counter", "[Metrics]")
+{
+    Counter counter;
+    auto add = [&] { for (uint32 i = 0; i < 10000; ++i) counter.Add(); };
+
+    std::thread first(add);
+    std::thread second(add);
+    first.join();
+    second.join();
+
+    REQUIRE(counter.GetValue() == 20000);
+}
+
+TEST_CASE("Registry", "[Metrics]")
+{
+    Registry registry;
+
+    SECTION("Metrics are registered once per name and labels")
+    {
+        Counter& counter = registry.GetCounter("test_counter_total", "Test counter", "type=\"a\"");
+        REQUIRE(&registry.GetCounter("test_counter_total", "Test counter", "type=\"a\"") == &counter);
+        REQUIRE(&registry.GetCounter("test_counter_total", "Test counter", "type=\"b\"") != &counter);
+    }
+
+    SECTION("Text exposition")
+    {
+        registry.GetCounter("test_counter_total", "Test counter", "type=\"a\"").Add(3);
+        registry.GetCounter("test_counter_total", "Test counter", "type=\"b\"").Add(4);
+        registry.GetGauge("test_gauge", "Test gauge").Set(-2);
+        registry.GetHistogram("test_duration_seconds", "Test histogram").Record(Milliseconds(3));
+
+        std::string text = registry.WriteTextExposition();
+        REQUIRE(text.find("# HELP test_counter_total Test counter\n# TYPE test_counter_total counter\n"
+            "test_counter_total{type=\"a\"} 3\ntest_counter_total{type=\"b\"} 4\n") != std::string::npos);
+        REQUIRE(text.find("# TYPE test_gauge gauge\ntest_gauge -2\n") != std::string::npos);
+        REQUIRE(text.find("# TYPE test_duration_seconds histogram\n") != std::string::npos);
+        REQUIRE(text.find("test_duration_seconds_bucket{le=\"0.002048\"} 0\n") != std::string::npos);
+        REQUIRE(text.find("test_duration_seconds_bucket{le=\"0.004096\"} 1\n") != std::string::npos);
+        // sub-buckets of the 2048-4096 us range
+        REQUIRE(text.find("test_duration_seconds_bucket{le=\"0.002816\"} 0\n") != std::string::npos);
+        REQUIRE(text.find("test_duration_seconds_bucket{le=\"0.003072\"} 1\n") != std::string::npos);
+        REQUIRE(text.find("test_duration_seconds_bucket{le=\"67.108864\"} 1\n") != std::string::npos);
+        REQUIRE(text.find("test_duration_seconds_bucket{le=\"+Inf\"} 1\n") != std::string::npos);
+        REQUIRE(text.find("test_duration_seconds_sum 0.003\n") != std::string::npos);
+        REQUIRE(text.find("test_duration_seconds_count 1\n") != std::string::npos);
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ShardedHashMap.h"
+#include "Define.h"
+
+using Trinity::Containers::ShardedHashMap;
+
+TEST_CASE("ShardedHashMap", "[ShardedHashMap]")
+{
+    ShardedHashMap<uint64, int*> map;
+    int values[3] = { };
+
+    SECTION("Inserted elements are found")
+    {
+        map.Insert(1, &values[0]);
+        map.Insert(2, &values[1]);
+        REQUIRE(map.Find(1) == &values[0]);
+        REQUIRE(map.Find(2) == &values[1]);
+        REQUIRE(map.Find(3) == nullptr);
+        REQUIRE(map.Size() == 2);
+    }
+
+    SECTION("Insert replaces existing element")
+    {
+        map.Insert(1, &values[0]);
+        map.Insert(1, &values[2]);
+        REQUIRE(map.Find(1) == &values[2]);
+        REQUIRE(map.Size() == 1);
+    }
+
+    SECTION("Removed elements are not found")
+    {
+        map.Insert(1, &values[0]);
+        REQUIRE(map.Remove(1));
+        REQUIRE_FALSE(map.Remove(1));
+        REQUIRE(map.Find(1) == nullptr);
+    }
+
+    SECTION("DoForAll visits every element once")
+    {
+        for (uint64 i = 0; i < 1000; ++i)
+            map.Insert(i, &values[i % 3]);
+
+        uint64 keySum = 0;
+        uint32 count = 0;
+        map.DoForAll([&](uint64 key, int*) { keySum += key; ++count; });
+        REQUIRE(count == 1000);
+        REQUIRE(keySum == 999 * 1000 / 2);
+    }
+
+    SECTION("DoForAll worker can modify the map")
+    {
+        for (uint64 i = 0; i < 100; ++i)
+            map.Insert(i, &values[0]);
+
+        uint32 count = 0;
+        map.DoForAll([&](uint64 key, int* value)
+        {
+            REQUIRE(value == &values[0]);
+            map.Remove(key);
+            ++count;
+        });
+
+        REQUIRE(count == 100);
+        REQUIRE(map.Size() == 0);
+        REQUIRE(Trinity::EpochReclamation::GetPendingCount() == 0);
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "TaskGraph.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace Trinity;
+using namespace std::chrono_literals;
+
+TEST_CASE("TaskGraph", "[TaskGraph]")
+{
+    std::size_t threads = GENERATE(1, 4);
+
+    SECTION("Dependencies finish before dependents start")
+    {
+        std::mutex lock;
+        std::vector<std::string> order;
+        auto record = [&](std::string name)
+        {
+            return [&, name]()
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                order.push_back(name);
+            };
+        };
+
+        TaskGraph graph;
+        TaskGraph::TaskId a = graph.AddTask("a", record("a"));
+        TaskGraph::TaskId b = graph.AddTask("b", record("b"));
+        TaskGraph::TaskId c = graph.AddTask("c", record("c"), { a, b });
+        graph.AddTask("d", record("d"), { c });
+        graph.Run(threads);
+
+        REQUIRE(order.size() == 4);
+        auto position = [&](std::string const& name) { return std::ranges::find(order, name) - order.begin(); };
+        REQUIRE(position("a") < position("c"));
+        REQUIRE(position("b") < position("c"));
+        REQUIRE(position("c") < position("d"));
+    }
+
+    SECTION("Every task runs once")
+    {
+        std::atomic<uint32> runs = 0;
+        TaskGraph graph;
+        std::vector<TaskGraph::TaskId> roots;
+        for (uint32 i = 0; i < 50; ++i)
+            roots.push_back(graph.AddTask("root", [&]() { ++runs; }));
+        for (uint32 i = 0; i < 50; ++i)
+            graph.AddTask("child", [&]() { ++runs; }, { roots[i], roots[(i + 1) % 50] });
+
+        graph.Run(threads);
+        REQUIRE(runs == 100);
+    }
+
+    SECTION("Critical path follows the longest chain")
+    {
+        TaskGraph graph;
+        TaskGraph::TaskId slow = graph.AddTask("slow", []() { std::this_thread::sleep_for(30ms); });
+        graph.AddTask("fast", []() { });
+        graph.AddTask("after slow", []() { std::this_thread::sleep_for(10ms); }, { slow });
+
+        TaskGraph::Timings timings = graph.Run(threads);
+        REQUIRE(timings.CriticalPathTasks == std::vector<std::string>{ "slow", "after slow" });
+        REQUIRE(timings.CriticalPath >= 40ms);
+        REQUIRE(timings.Total >= timings.CriticalPath);
+        REQUIRE(timings.Serial >= timings.CriticalPath);
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "GridObject.h"
+#include <memory>
+#include <set>
+
+namespace
+{
+    struct TestObject : GridObject<TestObject>
+    {
+        TestObject(float x, float y, float reach = 0.0f) : X(x), Y(y), Reach(reach) { }
+
+        float GetPositionX() const { return X; }
+        float GetPositionY() const { return Y; }
+        float GetCombatReach() const { return Reach; }
+
+        float X;
+        float Y;
+        float Reach;
+        uint32 Payload[32] = { };
+    };
+
+    std::set<TestObject*> CollectInRange(GridRefManager<TestObject> const& container, float x, float y, float range)
+    {
+        std::set<TestObject*> result;
+        container.VisitInRange(x, y, range, [&](TestObject* object)
+        {
+            result.insert(object);
+            return true;
+        });
+        return result;
+    }
+}
+
+TEST_CASE("GridRefManager packed storage", "[GridRefManager]")
+{
+    GridRefManager<TestObject> container;
+    TestObject near(1.0f, 1.0f);
+    TestObject far(50.0f, 0.0f);
+    TestObject big(50.0f, 0.0f, 45.0f);
+
+    near.AddToGrid(container);
+    far.AddToGrid(container);
+    big.AddToGrid(container);
+
+    SECTION("Objects are filtered by range and combat reach")
+    {
+        REQUIRE(CollectInRange(container, 0.0f, 0.0f, 10.0f) == std::set<TestObject*>{ &near, &big });
+    }
+
+    SECTION("Removal keeps remaining objects reachable")
+    {
+        near.RemoveFromGrid();
+        REQUIRE(container.getSize() == 2);
+        REQUIRE(CollectInRange(container, 0.0f, 0.0f, 100.0f) == std::set<TestObject*>{ &far, &big });
+    }
+
+    SECTION("Positions are refreshed on update")
+    {
+        far.X = 5.0f;
+        REQUIRE(CollectInRange(container, 0.0f, 0.0f, 10.0f) == std::set<TestObject*>{ &near, &big });
+        far.UpdateGridPosition();
+        REQUIRE(CollectInRange(container, 0.0f, 0.0f, 10.0f) == std::set<TestObject*>{ &near, &far, &big });
+    }
+
+    SECTION("Visit stops when visitor returns false")
+    {
+        uint32 visited = 0;
+        container.VisitInRange(0.0f, 0.0f, 100.0f, [&](TestObject*) { ++visited; return false; });
+        REQUIRE(visited == 1);
+    }
+
+    SECTION("Destroying container unlinks objects")
+    {
+        auto temporary = std::make_unique<GridRefManager<TestObject>>();
+        TestObject object(0.0f, 0.0f);
+        object.AddToGrid(*temporary);
+        temporary.reset();
+        REQUIRE_FALSE(object.IsInGrid());
+    }
+}
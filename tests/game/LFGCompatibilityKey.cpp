@@ -0,0 +1,143 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "LFGMgr.h"
+#include "LFGQueue.h"
+#include <chrono>
+#include <random>
+
+using namespace lfg;
+
+TEST_CASE("LfgCompatibilityKey", "[LFG]")
+{
+    SECTION("Same members in any order give the same key")
+    {
+        LfgCompatibilityKey a, b;
+        for (uint32 slot : { 7, 3, 11 })
+            a.Add(slot);
+        for (uint32 slot : { 11, 7, 3 })
+            b.Add(slot);
+
+        REQUIRE(a == b);
+        REQUIRE(LfgCompatibilityKeyHash()(a) == LfgCompatibilityKeyHash()(b));
+        REQUIRE(a.GetCount() == 3);
+    }
+
+    SECTION("Contains only added slots")
+    {
+        LfgCompatibilityKey key;
+        key.Add(5);
+        key.Add(2);
+        REQUIRE(key.Contains(2));
+        REQUIRE(key.Contains(5));
+        REQUIRE_FALSE(key.Contains(3));
+        REQUIRE_FALSE(LfgCompatibilityKey().Contains(0));
+    }
+
+    SECTION("Keys of different sizes differ")
+    {
+        LfgCompatibilityKey a, b;
+        a.Add(1);
+        b.Add(1);
+        b.Add(2);
+        REQUIRE_FALSE(a == b);
+        REQUIRE(a.IsEmpty() == false);
+        REQUIRE(LfgCompatibilityKey().IsEmpty());
+    }
+
+    SECTION("Slots beyond group size are ignored")
+    {
+        LfgCompatibilityKey key;
+        for (uint32 slot = 1; slot <= LfgCompatibilityKey::MaxSlots + 2; ++slot)
+            key.Add(slot);
+        REQUIRE(key.GetCount() == LfgCompatibilityKey::MaxSlots);
+    }
+}
+
+namespace
+{
+    // LFGMgr only lets the queue create proposals for players in LFG_STATE_QUEUED, which it sets on join.
+    // Bench players have no Player object to join with, a proposal declined by someone else puts the rest back to queued
+    void SetQueued(GuidList const& guids, ObjectGuid decliner)
+    {
+        LfgProposal proposal;
+        for (ObjectGuid const& guid : guids)
+            proposal.players[guid].accept = LFG_ANSWER_AGREE;
+        proposal.players[decliner].accept = LFG_ANSWER_PENDING;
+
+        uint32 proposalId = sLFGMgr->AddProposal(proposal);
+        sLFGMgr->UpdateProposal(proposalId, decliner, false);
+    }
+}
+
+TEST_CASE("LfgCompatibilityKey benchmark", "[.benchmark][LFG]")
+{
+    // every tick a batch of players joins and FindGroups runs, as in LFGMgr::Update
+    // players leave the queue some ticks after joining whether they were matched or not
+    constexpr uint32 Ticks = 200;
+    constexpr uint32 PlayersPerTick = 25;
+    constexpr uint32 TicksInQueue = 20;
+    constexpr uint32 DungeonCount = 8;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32> roleRoll(0, 99);
+    std::uniform_int_distribution<uint32> dungeonRoll(1, DungeonCount);
+
+    LFGQueue queue;
+    std::vector<GuidList> joined(Ticks);
+    uint64 nextGuid = 1;
+    uint32 matches = 0;
+    std::chrono::steady_clock::duration findTime = { };
+
+    for (uint32 tick = 0; tick < Ticks; ++tick)
+    {
+        if (tick >= TicksInQueue)
+            for (ObjectGuid const& guid : joined[tick - TicksInQueue])
+                queue.RemoveFromQueue(guid);
+
+        for (uint32 i = 0; i < PlayersPerTick; ++i)
+        {
+            ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(nextGuid++);
+
+            // dps heavy, like live queues
+            uint32 role = roleRoll(rng);
+            LfgRolesMap roles;
+            roles[guid] = role < 15 ? PLAYER_ROLE_TANK : role < 35 ? PLAYER_ROLE_HEALER : PLAYER_ROLE_DAMAGE;
+
+            LfgDungeonSet dungeons;
+            for (uint32 count = dungeonRoll(rng) % 3 + 1; dungeons.size() < count;)
+                dungeons.insert(dungeonRoll(rng));
+
+            queue.AddQueueData(guid, time_t(tick), dungeons, roles);
+            joined[tick].push_back(guid);
+        }
+
+        SetQueued(joined[tick], ObjectGuid::Create<HighGuid::Player>(nextGuid++));
+
+        auto start = std::chrono::steady_clock::now();
+        matches += queue.FindGroups();
+        findTime += std::chrono::steady_clock::now() - start;
+    }
+
+    int64 micros = std::max<int64>(1, std::chrono::duration_cast<std::chrono::microseconds>(findTime).count());
+    WARN(Ticks * PlayersPerTick << " players, " << matches << " groups matched in " << micros / 1000 << " ms of FindGroups: "
+        << uint64(matches) * 1000000 / micros << " matches/s");
+    WARN(queue.DumpQueueInfo() << queue.DumpCompatibleInfo() << "Compatible entry size: " << sizeof(LfgCompatibleContainer::value_type) << " bytes");
+    REQUIRE(matches > 0);
+}
@@ -0,0 +1,92 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MapUpdater.h"
+#include <array>
+
+namespace
+{
+    std::vector<uint32> PopAll(MapUpdateQueues& queues, size_t workerIndex, std::vector<bool>* stolen = nullptr)
+    {
+        std::vector<uint32> requests;
+        uint32 requestIndex = 0;
+        bool wasStolen = false;
+        while (queues.Pop(workerIndex, requestIndex, wasStolen))
+        {
+            requests.push_back(requestIndex);
+            if (stolen)
+                stolen->push_back(wasStolen);
+        }
+        return requests;
+    }
+}
+
+TEST_CASE("MapUpdateQueues", "[MapUpdater]")
+{
+    MapUpdateQueues queues;
+    queues.Resize(2);
+
+    SECTION("Longest predicted update is served first")
+    {
+        std::array<Microseconds, 4> predicted = { Microseconds(10), Microseconds(50), Microseconds(30), Microseconds(20) };
+        queues.Dispatch(predicted);
+
+        // 50 -> worker 0, 30 -> worker 1, 20 -> worker 1 (30 < 50), 10 -> worker 0 (50 == 50, first wins)
+        uint32 requestIndex = 0;
+        bool stolen = false;
+        REQUIRE(queues.Pop(0, requestIndex, stolen));
+        REQUIRE(requestIndex == 1);
+        REQUIRE_FALSE(stolen);
+        REQUIRE(queues.Pop(1, requestIndex, stolen));
+        REQUIRE(requestIndex == 2);
+        REQUIRE_FALSE(stolen);
+
+        REQUIRE(PopAll(queues, 0) == std::vector<uint32>{ 0, 3 });
+        REQUIRE(PopAll(queues, 1).empty());
+    }
+
+    SECTION("Maps without history are spread round robin")
+    {
+        std::array<Microseconds, 4> predicted = { };
+        queues.Dispatch(predicted);
+
+        REQUIRE(PopAll(queues, 0).size() + PopAll(queues, 1).size() == 4);
+
+        queues.Dispatch(predicted);
+        uint32 requestIndex = 0;
+        bool stolen = false;
+        REQUIRE(queues.Pop(0, requestIndex, stolen));
+        REQUIRE(requestIndex == 0);
+        REQUIRE(queues.Pop(1, requestIndex, stolen));
+        REQUIRE(requestIndex == 1);
+        REQUIRE_FALSE(stolen);
+    }
+
+    SECTION("Idle worker steals the cheapest request of another worker")
+    {
+        queues.Resize(3);
+        std::array<Microseconds, 5> predicted = { Microseconds(1000), Microseconds(40), Microseconds(30), Microseconds(20), Microseconds(10) };
+        queues.Dispatch(predicted);
+
+        // worker 0: 1000, worker 1: 40 10, worker 2: 30 20
+        std::vector<bool> stolen;
+        REQUIRE(PopAll(queues, 0, &stolen) == std::vector<uint32>{ 0, 4, 1, 3, 2 });
+        REQUIRE(stolen == std::vector<bool>{ false, true, true, true, true });
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "CUFProfile.h"
+#include "PlayerSaveSlots.h"
+#include "SharedDefines.h"
+#include <vector>
+
+namespace
+{
+    template<std::size_t SlotCount>
+    std::vector<std::size_t> SaveSlots(PlayerSaveSlots<SlotCount>& slots, std::size_t* skipped = nullptr)
+    {
+        std::vector<std::size_t> written;
+        std::size_t skippedSlots = slots.Save([&](std::size_t slot) { written.push_back(slot); });
+        if (skipped)
+            *skipped = skippedSlots;
+
+        return written;
+    }
+}
+
+TEST_CASE("PlayerSaveSlots", "[PlayerSaveSlots]")
+{
+    SECTION("Nothing is written without changes")
+    {
+        PlayerSaveSlots<VOID_STORAGE_MAX_SLOT> voidStorage;
+        std::size_t skipped = 0;
+        REQUIRE(SaveSlots(voidStorage, &skipped).empty());
+        REQUIRE(skipped == VOID_STORAGE_MAX_SLOT);
+    }
+
+    SECTION("Changed void storage slots are written once")
+    {
+        PlayerSaveSlots<VOID_STORAGE_MAX_SLOT> voidStorage;
+
+        // deposit into slot 7, then swap it with slot 42
+        voidStorage.SetChanged(7);
+        voidStorage.SetChanged(42);
+        voidStorage.SetChanged(7);
+        REQUIRE(voidStorage.IsChanged(7));
+        REQUIRE_FALSE(voidStorage.IsChanged(8));
+
+        std::size_t skipped = 0;
+        REQUIRE(SaveSlots(voidStorage, &skipped) == std::vector<std::size_t>{ 7, 42 });
+        REQUIRE(skipped == VOID_STORAGE_MAX_SLOT - 2);
+        REQUIRE_FALSE(voidStorage.IsChanged(7));
+
+        REQUIRE(SaveSlots(voidStorage).empty());
+
+        voidStorage.SetChanged(VOID_STORAGE_MAX_SLOT - 1);
+        REQUIRE(SaveSlots(voidStorage) == std::vector<std::size_t>{ VOID_STORAGE_MAX_SLOT - 1 });
+        REQUIRE(SaveSlots(voidStorage).empty());
+    }
+
+    SECTION("Changed CUF profiles are written once")
+    {
+        PlayerSaveSlots<MAX_CUF_PROFILES> profiles;
+        profiles.SetChanged(0);
+        profiles.SetChanged(MAX_CUF_PROFILES - 1);
+
+        std::size_t skipped = 0;
+        REQUIRE(SaveSlots(profiles, &skipped) == std::vector<std::size_t>{ 0, MAX_CUF_PROFILES - 1 });
+        REQUIRE(skipped == MAX_CUF_PROFILES - 2);
+        REQUIRE(SaveSlots(profiles).empty());
+    }
+}
+
+TEST_CASE("PlayerChangedSaveData", "[PlayerSaveSlots]")
+{
+    // same shape as Player::_SaveBGData, which deletes and inserts its row when battleground data changed
+    PlayerChangedSaveData changedSaveData;
+    uint32 writes = 0;
+    auto saveBGData = [&] { return changedSaveData.Save(PlayerSaveData::BGData, 2, [&] { ++writes; }); };
+
+    SECTION("Unchanged data is skipped")
+    {
+        REQUIRE(saveBGData() == 2);
+        REQUIRE(writes == 0);
+    }
+
+    SECTION("Changed data is written once")
+    {
+        changedSaveData.SetChanged(PlayerSaveData::BGData);
+        changedSaveData.SetChanged(PlayerSaveData::BGData);
+        REQUIRE(saveBGData() == 0);
+        REQUIRE(writes == 1);
+
+        REQUIRE(saveBGData() == 2);
+        REQUIRE(writes == 1);
+    }
+
+    SECTION("Other data does not cause a write")
+    {
+        changedSaveData.SetChanged(PlayerSaveData::InstanceTimes | PlayerSaveData::DailyQuests);
+        REQUIRE(saveBGData() == 2);
+        REQUIRE(writes == 0);
+        REQUIRE(changedSaveData.Consume(PlayerSaveData::InstanceTimes));
+        REQUIRE(changedSaveData.Consume(PlayerSaveData::DailyQuests));
+    }
+
+    SECTION("Cleared data is skipped")
+    {
+        // quests reset by the daily/weekly reset are deleted from the database directly
+        changedSaveData.SetChanged(PlayerSaveData::BGData | PlayerSaveData::DailyQuests);
+        changedSaveData.ClearChanged(PlayerSaveData::DailyQuests);
+        REQUIRE_FALSE(changedSaveData.Consume(PlayerSaveData::DailyQuests));
+        REQUIRE(saveBGData() == 0);
+        REQUIRE(writes == 1);
+    }
+}
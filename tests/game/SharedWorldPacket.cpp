@@ -0,0 +1,175 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "BufferPool.h"
+#include "Opcodes.h"
+#include "SharedWorldPacket.h"
+#include "WorldPacket.h"
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <optional>
+
+namespace
+{
+    // stands in for a WorldSocket send queue - WorldSocket::SendPacket queues the shared packet by reference
+    struct TestSession
+    {
+        void SendPacket(WorldPacket const& packet)
+        {
+            if (std::shared_ptr<SharedWorldPacket const> shared = WorldPacketBroadcast::GetSharedPacket(packet))
+                Queue.push_back(std::move(shared));
+        }
+
+        std::deque<std::shared_ptr<SharedWorldPacket const>> Queue;
+    };
+
+    WorldPacket MakePacket(std::size_t size)
+    {
+        WorldPacket packet(SMSG_CHAT, size);
+        for (std::size_t i = 0; i < size; ++i)
+            packet << uint8(i * 7 + 3);
+        return packet;
+    }
+
+    bool HasContent(SharedWorldPacket const& shared, std::size_t size)
+    {
+        std::span<uint8 const> data = shared.GetData();
+        if (data.size() != size + sizeof(uint32))
+            return false;
+
+        uint32 opcode;
+        memcpy(&opcode, data.data(), sizeof(uint32));
+        if (opcode != SMSG_CHAT)
+            return false;
+
+        for (std::size_t i = 0; i < size; ++i)
+            if (data[sizeof(uint32) + i] != uint8(i * 7 + 3))
+                return false;
+
+        return true;
+    }
+}
+
+TEST_CASE("SharedWorldPacket", "[SharedWorldPacket]")
+{
+    constexpr std::size_t PacketSize = 300;
+
+    WorldPacketSendStatistics::Consume();
+
+    SECTION("Packet not being broadcast is not shared")
+    {
+        WorldPacket packet = MakePacket(PacketSize);
+        REQUIRE(WorldPacketBroadcast::GetSharedPacket(packet) == nullptr);
+
+        WorldPacket other = MakePacket(PacketSize);
+        WorldPacketBroadcast broadcast(other);
+        REQUIRE(WorldPacketBroadcast::GetSharedPacket(packet) == nullptr);
+    }
+
+    SECTION("Broadcast copies packet once for all sessions")
+    {
+        std::vector<TestSession> sessions(8);
+        {
+            WorldPacket packet = MakePacket(PacketSize);
+            WorldPacketBroadcast broadcast(packet);
+            for (TestSession& session : sessions)
+                session.SendPacket(packet);
+        }
+
+        for (TestSession const& session : sessions)
+        {
+            REQUIRE(session.Queue.size() == 1);
+            REQUIRE(session.Queue.front() == sessions.front().Queue.front());
+        }
+
+        REQUIRE(sessions.front().Queue.front().use_count() == 8);
+        REQUIRE(HasContent(*sessions.front().Queue.front(), PacketSize));
+
+        WorldPacketSendStatistics statistics = WorldPacketSendStatistics::Consume();
+        REQUIRE(statistics.CopiedBytes == PacketSize);
+    }
+
+    SECTION("Nested broadcasts share each packet separately")
+    {
+        TestSession session;
+        WorldPacket outer = MakePacket(PacketSize);
+        WorldPacket inner = MakePacket(PacketSize / 2);
+
+        WorldPacketBroadcast outerBroadcast(outer);
+        session.SendPacket(outer);
+        {
+            WorldPacketBroadcast innerBroadcast(inner);
+            session.SendPacket(inner);
+            session.SendPacket(outer);
+        }
+        session.SendPacket(inner);
+
+        REQUIRE(session.Queue.size() == 3);
+        REQUIRE(session.Queue[0] == session.Queue[2]);
+        REQUIRE(session.Queue[0] != session.Queue[1]);
+        REQUIRE(session.Queue[1]->GetPayloadSize() == PacketSize / 2);
+    }
+
+    SECTION("Buffer stays intact while some sessions are still sending it")
+    {
+        std::vector<TestSession> sessions(6);
+        std::optional<WorldPacket> packet = MakePacket(PacketSize);
+        {
+            WorldPacketBroadcast broadcast(*packet);
+            for (TestSession& session : sessions)
+                session.SendPacket(*packet);
+        }
+
+        // source packet is gone and overwritten before anything was sent
+        packet->clear();
+        packet.reset();
+
+        std::weak_ptr<SharedWorldPacket const> weak = sessions.front().Queue.front();
+
+        // half of the sessions finish sending, the others are still waiting for their socket
+        for (std::size_t i = 0; i < sessions.size() / 2; ++i)
+            sessions[i].Queue.pop_front();
+
+        REQUIRE(!weak.expired());
+
+        // churn the pool with buffers of the same size class, none of them may alias the shared one
+        std::vector<std::vector<uint8>> churn;
+        for (uint32 i = 0; i < 64; ++i)
+        {
+            std::vector<uint8> buffer = Trinity::BufferPool::Acquire(PacketSize + sizeof(uint32));
+            buffer.assign(PacketSize + sizeof(uint32), 0xFF);
+            churn.push_back(std::move(buffer));
+        }
+
+        for (std::vector<uint8>& buffer : churn)
+            Trinity::BufferPool::Release(std::move(buffer));
+
+        for (std::size_t i = sessions.size() / 2; i < sessions.size(); ++i)
+        {
+            REQUIRE(sessions[i].Queue.size() == 1);
+            REQUIRE(HasContent(*sessions[i].Queue.front(), PacketSize));
+        }
+
+        for (std::size_t i = sessions.size() / 2; i < sessions.size(); ++i)
+            sessions[i].Queue.pop_front();
+
+        REQUIRE(weak.expired());
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "SmartScriptMgr.h"
+
+namespace
+{
+    SmartScriptHolder MakeEvent(uint32 id, SMART_EVENT type)
+    {
+        SmartScriptHolder holder;
+        holder.event_id = id;
+        holder.event.type = type;
+        return holder;
+    }
+
+    // event ids of events with given type, in list order
+    std::vector<uint32> FilterLinear(SmartAIEventList const& events, SMART_EVENT type)
+    {
+        std::vector<uint32> ids;
+        for (SmartScriptHolder const& e : events)
+            if (e.GetEventType() == uint32(type))
+                ids.push_back(e.event_id);
+        return ids;
+    }
+
+    std::vector<uint32> FilterIndexed(SmartAIEventList const& events, SmartEventIndex const& index, SMART_EVENT type)
+    {
+        std::vector<uint32> ids;
+        for (uint32 position : index.GetPositions(type))
+            ids.push_back(events[position].event_id);
+        return ids;
+    }
+}
+
+TEST_CASE("SmartEventIndex", "[SmartEventIndex]")
+{
+    SmartAIEventList events;
+    SmartEventIndex index;
+
+    SECTION("Empty list has no events of any type")
+    {
+        index.Build(events);
+        for (uint32 type = 0; type < SMART_EVENT_END; ++type)
+            REQUIRE(index.GetPositions(SMART_EVENT(type)).empty());
+    }
+
+    SECTION("Events are grouped by type in list order")
+    {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<uint32> typeDist(0, SMART_EVENT_END - 1);
+        for (uint32 i = 0; i < 200; ++i)
+            events.push_back(MakeEvent(i, SMART_EVENT(typeDist(rng))));
+
+        index.Build(events);
+        for (uint32 type = 0; type < SMART_EVENT_END; ++type)
+            REQUIRE(FilterIndexed(events, index, SMART_EVENT(type)) == FilterLinear(events, SMART_EVENT(type)));
+    }
+
+    SECTION("Rebuilding follows reordering")
+    {
+        events = { MakeEvent(0, SMART_EVENT_UPDATE_IC), MakeEvent(1, SMART_EVENT_AGGRO), MakeEvent(2, SMART_EVENT_UPDATE_IC) };
+        index.Build(events);
+        REQUIRE(FilterIndexed(events, index, SMART_EVENT_UPDATE_IC) == std::vector<uint32>{ 0, 2 });
+
+        std::swap(events[0], events[2]);
+        index.Build(events);
+        REQUIRE(FilterIndexed(events, index, SMART_EVENT_UPDATE_IC) == std::vector<uint32>{ 2, 0 });
+        REQUIRE(FilterIndexed(events, index, SMART_EVENT_AGGRO) == std::vector<uint32>{ 1 });
+    }
+
+    SECTION("Out of range types have no events")
+    {
+        events.push_back(MakeEvent(0, SMART_EVENT_END));
+        index.Build(events);
+        REQUIRE(index.GetPositions(SMART_EVENT_END).empty());
+    }
+}
@@ -0,0 +1,210 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ByteBuffer.h"
+#include "ObjectMgr.h"
+#include "StartupSnapshot.h"
+#include "WaypointManager.h"
+
+namespace
+{
+StartupSnapshotReader MakeReader(ByteBuffer const& data)
+{
+    return StartupSnapshotReader({ data.data(), data.size() });
+}
+}
+
+TEST_CASE("StartupSnapshot header", "[StartupSnapshot]")
+{
+    ByteBuffer data;
+    StartupSnapshot::WriteHeader(data, 3, "abc-123");
+    StartupSnapshotReader reader = MakeReader(data);
+
+    SECTION("Matches same version and key")
+    {
+        REQUIRE(StartupSnapshot::ReadHeader(reader, 3, "abc-123"));
+        REQUIRE_NOTHROW(reader.ReadEnd());
+    }
+
+    SECTION("Rejects different version")
+    {
+        REQUIRE_FALSE(StartupSnapshot::ReadHeader(reader, 4, "abc-123"));
+    }
+
+    SECTION("Rejects different world database")
+    {
+        REQUIRE_FALSE(StartupSnapshot::ReadHeader(reader, 3, "abc-124"));
+    }
+
+    SECTION("Truncated header throws")
+    {
+        StartupSnapshotReader truncated({ data.data(), 5 });
+        REQUIRE_THROWS_AS(StartupSnapshot::ReadHeader(truncated, 3, "abc-123"), ByteBufferException);
+    }
+}
+
+TEST_CASE("StartupSnapshotReader", "[StartupSnapshot]")
+{
+    ByteBuffer data;
+    data << uint32(2) << "ab" << float(1.5f);
+    StartupSnapshotReader reader = MakeReader(data);
+
+    REQUIRE(reader.ReadCount() == 2);
+    REQUIRE(reader.ReadCString() == "ab");
+    REQUIRE_THROWS_AS(reader.ReadEnd(), ByteBufferException);
+    REQUIRE(reader.read<float>() == 1.5f);
+    REQUIRE_NOTHROW(reader.ReadEnd());
+    REQUIRE_THROWS_AS(reader.read<uint8>(), ByteBufferPositionException);
+
+    SECTION("Unterminated string throws")
+    {
+        StartupSnapshotReader unterminated({ data.data() + 4, 2 });
+        REQUIRE_THROWS_AS(unterminated.ReadCString(), ByteBufferPositionException);
+    }
+
+    SECTION("Count larger than remaining data throws")
+    {
+        ByteBuffer corrupted;
+        corrupted << uint32(5) << uint32(0);
+        StartupSnapshotReader corruptedReader = MakeReader(corrupted);
+        REQUIRE_THROWS_AS(corruptedReader.ReadCount(), ByteBufferPositionException);
+    }
+}
+
+TEST_CASE("WaypointMgr snapshot", "[StartupSnapshot]")
+{
+    // three paths, first with both optional node fields set and a segment
+    // last one rejected for its MoveType while loading from database, with Id left 0
+    ByteBuffer data;
+    data << uint32(3);
+
+    data << uint32(10) << uint32(10) << uint8(WaypointMoveType::Run) << uint8(WaypointPathFlags::FollowPathBackwardsFromEndToStart) << float(2.5f);
+    data << uint32(2);
+    data << uint32(1) << float(1.0f) << float(2.0f) << float(3.0f) << uint8(1) << float(0.5f) << uint32(1500) << uint8(WaypointMoveType::Run);
+    data << uint32(2) << float(4.0f) << float(5.0f) << float(6.0f) << uint8(0) << float(0.0f) << uint32(0) << uint8(WaypointMoveType::Walk);
+    data << uint32(1) << uint32(0) << uint32(2);
+
+    data << uint32(20) << uint32(20) << uint8(WaypointMoveType::Walk) << uint8(WaypointPathFlags::None) << float(0.0f);
+    data << uint32(0);
+    data << uint32(0);
+
+    data << uint32(30) << uint32(0) << uint8(WaypointMoveType::Max) << uint8(WaypointPathFlags::None) << float(0.0f);
+    data << uint32(0);
+    data << uint32(0);
+
+    StartupSnapshotReader reader = MakeReader(data);
+    sWaypointMgr->ReadSnapshot(reader);
+
+    WaypointPath const* path = sWaypointMgr->GetPath(10);
+    REQUIRE(path);
+    REQUIRE(path->MoveType == WaypointMoveType::Run);
+    REQUIRE(path->Flags.HasFlag(WaypointPathFlags::FollowPathBackwardsFromEndToStart));
+    REQUIRE(path->Velocity == 2.5f);
+    REQUIRE(path->Nodes.size() == 2);
+    REQUIRE(path->Nodes[0].Orientation == 0.5f);
+    REQUIRE(path->Nodes[0].Delay == 1500ms);
+    REQUIRE_FALSE(path->Nodes[1].Orientation);
+    REQUIRE_FALSE(path->Nodes[1].Delay);
+    REQUIRE(path->ContinuousSegments == std::vector<std::pair<std::size_t, std::size_t>>{ { 0, 2 } });
+
+    WaypointPath const* emptyPath = sWaypointMgr->GetPath(20);
+    REQUIRE(emptyPath);
+    REQUIRE_FALSE(emptyPath->Velocity);
+    REQUIRE(emptyPath->Nodes.empty());
+
+    WaypointPath const* invalidPath = sWaypointMgr->GetPath(30);
+    REQUIRE(invalidPath);
+    REQUIRE(invalidPath->Id == 0);
+    REQUIRE_FALSE(sWaypointMgr->GetPath(0));
+
+    SECTION("Written snapshot reads back the same paths")
+    {
+        ByteBuffer written;
+        sWaypointMgr->WriteSnapshot(written);
+        REQUIRE(written.size() == data.size());
+
+        StartupSnapshotReader writtenReader = MakeReader(written);
+        sWaypointMgr->ReadSnapshot(writtenReader);
+        REQUIRE(sWaypointMgr->GetPath(10)->Nodes[0].Delay == 1500ms);
+        REQUIRE(sWaypointMgr->GetPath(20));
+        REQUIRE(sWaypointMgr->GetPath(30));
+    }
+
+    SECTION("Corrupted count throws instead of allocating")
+    {
+        ByteBuffer corrupted;
+        corrupted << uint32(0xFFFFFFFF);
+        StartupSnapshotReader corruptedReader = MakeReader(corrupted);
+        REQUIRE_THROWS_AS(sWaypointMgr->ReadSnapshot(corruptedReader), ByteBufferException);
+        REQUIRE(sWaypointMgr->GetPath(10));
+    }
+}
+
+TEST_CASE("ObjectMgr gameobject template snapshot", "[StartupSnapshot]")
+{
+    // a transport with its spawn map and a door with a script
+    ByteBuffer data;
+    data << uint32(2);
+
+    data << uint32(100) << uint32(GAMEOBJECT_TYPE_MAP_OBJ_TRANSPORT) << uint32(7) << "Boat" << "" << "" << "" << float(1.0f) << int32(0);
+    for (uint32 i = 0; i < MAX_GAMEOBJECT_DATA; ++i)
+        data << uint32(i == 6 ? 1234 : 0);  // moTransport.SpawnMap
+    data << "" << "" << "";
+
+    data << uint32(200) << uint32(GAMEOBJECT_TYPE_DOOR) << uint32(8) << "Door" << "" << "Opening" << "" << float(2.0f) << int32(5);
+    for (uint32 i = 0; i < MAX_GAMEOBJECT_DATA; ++i)
+        data << uint32(i);
+    data << "" << "go_snapshot_test_door" << "door_string";
+
+    StartupSnapshotReader reader = MakeReader(data);
+    sObjectMgr->ReadGameObjectTemplateSnapshot(reader);
+
+    GameObjectTemplate const* transport = sObjectMgr->GetGameObjectTemplate(100);
+    REQUIRE(transport);
+    REQUIRE(transport->moTransport.SpawnMap == 1234);
+    REQUIRE(sObjectMgr->IsTransportMap(1234));
+
+    GameObjectTemplate const* door = sObjectMgr->GetGameObjectTemplate(200);
+    REQUIRE(door);
+    REQUIRE(door->castBarCaption == "Opening");
+    REQUIRE(door->size == 2.0f);
+    REQUIRE(door->ContentTuningId == 5);
+    REQUIRE(door->raw.data[MAX_GAMEOBJECT_DATA - 1] == MAX_GAMEOBJECT_DATA - 1);
+    REQUIRE(sObjectMgr->GetScriptName(door->ScriptId) == "go_snapshot_test_door");
+    REQUIRE(door->StringId == "door_string");
+
+    SECTION("Written snapshot reads back the same templates")
+    {
+        ByteBuffer written;
+        sObjectMgr->WriteGameObjectTemplateSnapshot(written);
+        REQUIRE(written.size() == data.size());
+
+        StartupSnapshotReader writtenReader = MakeReader(written);
+        sObjectMgr->ReadGameObjectTemplateSnapshot(writtenReader);
+        REQUIRE(sObjectMgr->GetGameObjectTemplate(200)->StringId == "door_string");
+        REQUIRE(sObjectMgr->IsTransportMap(1234));
+    }
+
+    SECTION("Truncated snapshot keeps loaded templates")
+    {
+        StartupSnapshotReader truncated({ data.data(), data.size() - 1 });
+        REQUIRE_THROWS_AS(sObjectMgr->ReadGameObjectTemplateSnapshot(truncated), ByteBufferException);
+        REQUIRE(sObjectMgr->GetGameObjectTemplate(100));
+    }
+}
@@ -0,0 +1,155 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Object.h"
+#include "ViewerDependentValues.h"
+#include <map>
+
+namespace
+{
+    struct TestData
+    {
+        uint32 Shared = 0;
+        std::map<Player const*, uint32> PerViewer;
+    };
+
+    struct TestValueTag
+    {
+        using value_type = uint32;
+    };
+
+    struct TestListTag
+    {
+        using value_type = std::vector<uint32> const*;
+    };
+}
+
+template<>
+class UF::ViewerDependentValueImpl<TestValueTag>
+{
+public:
+    using value_type = TestValueTag::value_type;
+
+    static value_type GetValue(TestData const* data, Object const* /*object*/, Player const* receiver)
+    {
+        auto itr = data->PerViewer.find(receiver);
+        return itr != data->PerViewer.end() ? itr->second : 0;
+    }
+};
+
+template<>
+class UF::ViewerDependentValueImpl<TestListTag>
+{
+public:
+    using value_type = TestListTag::value_type;
+
+    static value_type GetValue(TestData const* /*data*/, Object const* /*object*/, Player const* /*receiver*/)
+    {
+        return nullptr;
+    }
+};
+
+namespace
+{
+    // viewers are only used as keys and never dereferenced
+    Player const* MakeViewer(uint8& storage) { return reinterpret_cast<Player const*>(&storage); }
+
+    void WriteBlock(ByteBuffer& block, TestData const& data, Player const* receiver)
+    {
+        block << uint32(data.Shared);
+        block << uint32(UF::ViewerDependentValue<TestValueTag>::GetValue(&data, static_cast<Object const*>(nullptr), receiver));
+        block << uint32(data.Shared);
+    }
+}
+
+TEST_CASE("ValuesUpdateBlockCache", "[Objects]")
+{
+    uint8 viewerStorage[3] = { };
+    Player const* first = MakeViewer(viewerStorage[0]);
+    Player const* second = MakeViewer(viewerStorage[1]);
+    Player const* third = MakeViewer(viewerStorage[2]);
+
+    TestData data;
+    data.Shared = 7;
+    data.PerViewer = { { first, 100 }, { second, 200 }, { third, 300 } };
+
+    uint32 builds = 0;
+    auto build = [&](ByteBuffer& block, Player const* receiver)
+    {
+        ++builds;
+        WriteBlock(block, data, receiver);
+    };
+
+    auto readFor = [&](ValuesUpdateBlockCache::Entry const& entry, Player const* receiver)
+    {
+        ByteBuffer buffer;
+        buffer << uint8(0xFF);  // blocks are appended after other data
+        REQUIRE(entry.CanAppendFor(receiver));
+        entry.AppendTo(buffer, receiver);
+        REQUIRE(buffer.read<uint8>() == 0xFF);
+
+        std::array<uint32, 3> values;
+        for (uint32& value : values)
+            value = buffer.read<uint32>();
+        return values;
+    };
+
+    SECTION("Block is built once and reused by viewers with same flags")
+    {
+        ValuesUpdateBlockCache& cache = ValuesUpdateBlockCache::AcquireForCurrentThread();
+        ValuesUpdateBlockCache::Entry const& firstEntry = cache.Get(UF::UpdateFieldFlag::None, first, build);
+        ValuesUpdateBlockCache::Entry const& secondEntry = cache.Get(UF::UpdateFieldFlag::None, second, build);
+
+        REQUIRE(builds == 1);
+        REQUIRE(&firstEntry == &secondEntry);
+        REQUIRE(firstEntry.Shareable);
+        REQUIRE(readFor(firstEntry, first) == std::array<uint32, 3>{ 7, 100, 7 });
+        REQUIRE(readFor(secondEntry, second) == std::array<uint32, 3>{ 7, 200, 7 });
+
+        cache.Get(UF::UpdateFieldFlag::Owner, third, build);
+        REQUIRE(builds == 2);
+    }
+
+    SECTION("Blocks are rebuilt for the next update after fields changed")
+    {
+        ValuesUpdateBlockCache::Entry const& before = ValuesUpdateBlockCache::AcquireForCurrentThread().Get(UF::UpdateFieldFlag::None, first, build);
+        REQUIRE(readFor(before, second) == std::array<uint32, 3>{ 7, 200, 7 });
+
+        data.Shared = 8;
+        data.PerViewer[second] = 201;
+
+        ValuesUpdateBlockCache::Entry const& after = ValuesUpdateBlockCache::AcquireForCurrentThread().Get(UF::UpdateFieldFlag::None, first, build);
+        REQUIRE(builds == 2);
+        REQUIRE(readFor(after, second) == std::array<uint32, 3>{ 8, 201, 8 });
+    }
+
+    SECTION("Blocks with viewer dependent lists are only valid for their first viewer")
+    {
+        ValuesUpdateBlockCache& cache = ValuesUpdateBlockCache::AcquireForCurrentThread();
+        ValuesUpdateBlockCache::Entry const& entry = cache.Get(UF::UpdateFieldFlag::None, first, [&](ByteBuffer& block, Player const* receiver)
+        {
+            build(block, receiver);
+            UF::ViewerDependentValue<TestListTag>::GetValue(&data, static_cast<Object const*>(nullptr), receiver);
+        });
+
+        REQUIRE_FALSE(entry.Shareable);
+        REQUIRE(entry.CanAppendFor(first));
+        REQUIRE_FALSE(entry.CanAppendFor(second));
+    }
+}
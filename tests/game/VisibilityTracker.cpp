@@ -0,0 +1,122 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "VisibilityTracker.h"
+#include "Cell.h"
+
+using namespace Trinity;
+
+namespace
+{
+    // center of the cell with given coordinates
+    float CellCenter(uint32 coord)
+    {
+        return (float(coord) - CENTER_GRID_CELL_ID + 0.5f) * SIZE_OF_GRID_CELL;
+    }
+
+    VisibilityTracker::CellState MakeState(CellCoord const& cell, uint32 version, float x, float y, float sightRange)
+    {
+        return { cell.GetId(), version, ClassifyCell(cell, x, y, sightRange) };
+    }
+}
+
+TEST_CASE("ClassifyCell", "[VisibilityTracker]")
+{
+    CellCoord center(CENTER_GRID_CELL_ID + 10, CENTER_GRID_CELL_ID + 10);
+    float x = CellCenter(center.x_coord);
+    float y = CellCenter(center.y_coord);
+
+    SECTION("Cell of the viewer is always evaluated")
+    {
+        REQUIRE(ClassifyCell(center, x, y, 500.0f) == CellVisibility::Partial);
+    }
+
+    SECTION("Cells within sight range but away from the viewer are inside")
+    {
+        REQUIRE(ClassifyCell(CellCoord(center.x_coord + 2, center.y_coord), x, y, 500.0f) == CellVisibility::Inside);
+    }
+
+    SECTION("Cells crossing sight range are partial")
+    {
+        REQUIRE(ClassifyCell(CellCoord(center.x_coord + 2, center.y_coord), x, y, 150.0f) == CellVisibility::Partial);
+    }
+
+    SECTION("Cells beyond sight range and margin are outside")
+    {
+        REQUIRE(ClassifyCell(CellCoord(center.x_coord + 4, center.y_coord), x, y, 100.0f) == CellVisibility::Outside);
+    }
+}
+
+TEST_CASE("VisibilityTracker pass semantics", "[VisibilityTracker]")
+{
+    CellCoord center(CENTER_GRID_CELL_ID + 10, CENTER_GRID_CELL_ID + 10);
+    CellCoord inside(center.x_coord + 2, center.y_coord);
+    float x = CellCenter(center.x_coord);
+    float y = CellCenter(center.y_coord);
+    float const sightRange = 500.0f;
+
+    VisibilityTracker tracker;
+
+    // first pass is always a full one
+    REQUIRE_FALSE(tracker.BeginPass(nullptr, sightRange, 5));
+    tracker.Record(MakeState(center, 1, x, y, sightRange));
+    tracker.Record(MakeState(inside, 1, x, y, sightRange));
+    tracker.EndPass();
+
+    SECTION("Unchanged cells are skipped")
+    {
+        REQUIRE(tracker.BeginPass(nullptr, sightRange, 5));
+        REQUIRE_FALSE(tracker.CanSkip(MakeState(center, 1, x, y, sightRange)));
+        REQUIRE(tracker.CanSkip(MakeState(inside, 1, x, y, sightRange)));
+    }
+
+    SECTION("Cells with changed membership are evaluated")
+    {
+        REQUIRE(tracker.BeginPass(nullptr, sightRange, 5));
+        REQUIRE_FALSE(tracker.CanSkip(MakeState(inside, 2, x, y, sightRange)));
+    }
+
+    SECTION("Invalidation and sight range changes force a full pass")
+    {
+        tracker.Invalidate();
+        REQUIRE_FALSE(tracker.BeginPass(nullptr, sightRange, 5));
+        tracker.EndPass();
+        REQUIRE_FALSE(tracker.BeginPass(nullptr, sightRange * 0.5f, 5));
+    }
+
+    SECTION("Full rescan interval is honored")
+    {
+        for (uint32 i = 0; i < 2; ++i)
+        {
+            REQUIRE(tracker.BeginPass(nullptr, sightRange, 2));
+            tracker.EndPass();
+        }
+        REQUIRE_FALSE(tracker.BeginPass(nullptr, sightRange, 2));
+    }
+
+    SECTION("Cells no longer recorded are reported as dropped")
+    {
+        REQUIRE(tracker.BeginPass(nullptr, sightRange, 5));
+        tracker.Record(MakeState(center, 1, x, y, sightRange));
+
+        std::vector<uint32> dropped;
+        tracker.ForEachDroppedCell([&](uint32 cellId) { dropped.push_back(cellId); });
+        REQUIRE(dropped == std::vector<uint32>{ inside.GetId() });
+    }
+}